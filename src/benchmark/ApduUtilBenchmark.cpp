@@ -0,0 +1,124 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+#include "ApduBatch.h"
+#include "ApduTemplate.h"
+#include "ApduUtil.h"
+
+using namespace keyple::core::util;
+
+static const uint8_t CLA = 0x00;
+static const uint8_t INS = 0xB2;
+static const uint8_t P1 = 0x01;
+static const uint8_t P2 = 0x14;
+static const uint8_t LE = 0x1D;
+
+/*
+ * Payload sizes range from a select application command to a full short APDU.
+ */
+#define APDU_SIZES Arg(8)->Arg(32)->Arg(128)->Arg(255)
+
+static void BM_BuildApdu_Vector(benchmark::State& state)
+{
+    const std::vector<uint8_t> dataIn(static_cast<size_t>(state.range(0)), 0x5A);
+
+    for (auto _ : state) {
+        std::vector<uint8_t> apdu = ApduUtil::build(CLA, INS, P1, P2, dataIn, LE);
+        benchmark::DoNotOptimize(apdu.data());
+    }
+}
+BENCHMARK(BM_BuildApdu_Vector)->APDU_SIZES;
+
+static void BM_BuildApdu_WriteScratchVector(benchmark::State& state)
+{
+    const std::vector<uint8_t> dataIn(static_cast<size_t>(state.range(0)), 0x5A);
+    std::vector<uint8_t> apdu;
+
+    for (auto _ : state) {
+        ApduUtil::write(CLA, INS, P1, P2, dataIn.data(), dataIn.size(), LE, apdu);
+        benchmark::DoNotOptimize(apdu.data());
+    }
+}
+BENCHMARK(BM_BuildApdu_WriteScratchVector)->APDU_SIZES;
+
+static void BM_BuildApdu_WriteBuffer(benchmark::State& state)
+{
+    const std::vector<uint8_t> dataIn(static_cast<size_t>(state.range(0)), 0x5A);
+    uint8_t apdu[261];
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(
+            ApduUtil::write(CLA, INS, P1, P2, dataIn.data(), dataIn.size(), LE, apdu));
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_BuildApdu_WriteBuffer)->APDU_SIZES;
+
+/*
+ * A ticketing transaction: 20 read record commands per card session.
+ */
+static const int TRANSACTION_COMMANDS = 20;
+
+static void BM_BuildTransaction_Vectors(benchmark::State& state)
+{
+    std::vector<std::vector<uint8_t>> apdus;
+    apdus.reserve(TRANSACTION_COMMANDS);
+
+    for (auto _ : state) {
+        apdus.clear();
+        for (int i = 0; i < TRANSACTION_COMMANDS; i++) {
+            apdus.push_back(ApduUtil::build(CLA, INS, static_cast<uint8_t>(i), P2, LE));
+        }
+        benchmark::DoNotOptimize(apdus.data());
+    }
+}
+BENCHMARK(BM_BuildTransaction_Vectors);
+
+static void BM_BuildTransaction_Batch(benchmark::State& state)
+{
+    ApduBatch batch;
+
+    for (auto _ : state) {
+        batch.reset();
+        for (int i = 0; i < TRANSACTION_COMMANDS; i++) {
+            batch.add(CLA, INS, static_cast<uint8_t>(i), P2, LE);
+        }
+        benchmark::DoNotOptimize(batch.getBytes().data());
+    }
+}
+BENCHMARK(BM_BuildTransaction_Batch);
+
+static void BM_BuildReadRecord_Build(benchmark::State& state)
+{
+    uint8_t record = 0;
+
+    for (auto _ : state) {
+        std::vector<uint8_t> apdu = ApduUtil::build(CLA, INS, record++, P2, LE);
+        benchmark::DoNotOptimize(apdu.data());
+    }
+}
+BENCHMARK(BM_BuildReadRecord_Build);
+
+static void BM_BuildReadRecord_Template(benchmark::State& state)
+{
+    ApduTemplate readRecord(CLA, INS, 0, P2, nullptr, 0, LE);
+    uint8_t record = 0;
+
+    for (auto _ : state) {
+        readRecord.setP1(record++);
+        benchmark::DoNotOptimize(readRecord.getBytes().data());
+        benchmark::ClobberMemory();
+    }
+}
+BENCHMARK(BM_BuildReadRecord_Template);
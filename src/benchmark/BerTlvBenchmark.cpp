@@ -0,0 +1,298 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+#include "BerTlvPath.h"
+#include "BerTlvUtil.h"
+#include "BerTlvWriter.h"
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> RECORD_ID = {0x20, 0x01, 0x07, 0x02, 0x1D, 0x01};
+static const std::vector<uint8_t> RECORD_DATA(16, 0x55);
+
+/**
+ * TLV encoding by concatenation of temporary vectors, as hand written before the writer.
+ */
+static std::vector<uint8_t> naiveTlv(const int tag, const std::vector<uint8_t>& value)
+{
+    std::vector<uint8_t> tlv;
+
+    if (tag > 0xFF) {
+        tlv.push_back(static_cast<uint8_t>(tag >> 8));
+    }
+    tlv.push_back(static_cast<uint8_t>(tag));
+
+    if (value.size() > 0xFF) {
+        tlv.push_back(0x82);
+        tlv.push_back(static_cast<uint8_t>(value.size() >> 8));
+        tlv.push_back(static_cast<uint8_t>(value.size()));
+    } else if (value.size() > 0x7F) {
+        tlv.push_back(0x81);
+        tlv.push_back(static_cast<uint8_t>(value.size()));
+    } else {
+        tlv.push_back(static_cast<uint8_t>(value.size()));
+    }
+
+    tlv.insert(tlv.end(), value.begin(), value.end());
+
+    return tlv;
+}
+
+/*
+ * Payload made of N records E1 {C1, C2} in a template E0, in a BF0C discretionary data object.
+ */
+#define TLV_RECORDS Arg(1)->Arg(8)->Arg(64)->Arg(512)
+
+static void BM_BuildTlv_Concatenation(benchmark::State& state)
+{
+    const int64_t records = state.range(0);
+    size_t size = 0;
+
+    for (auto _ : state) {
+        std::vector<uint8_t> list;
+
+        for (int64_t i = 0; i < records; i++) {
+            std::vector<uint8_t> record = naiveTlv(0xC1, RECORD_ID);
+            const std::vector<uint8_t> data = naiveTlv(0xC2, RECORD_DATA);
+            record.insert(record.end(), data.begin(), data.end());
+
+            const std::vector<uint8_t> tlv = naiveTlv(0xE1, record);
+            list.insert(list.end(), tlv.begin(), tlv.end());
+        }
+
+        const std::vector<uint8_t> payload = naiveTlv(0xBF0C, naiveTlv(0xE0, list));
+        size = payload.size();
+        benchmark::DoNotOptimize(payload.data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_BuildTlv_Concatenation)->TLV_RECORDS;
+
+static void BM_BuildTlv_Writer(benchmark::State& state)
+{
+    const int64_t records = state.range(0);
+    BerTlvWriter writer;
+    size_t size = 0;
+
+    for (auto _ : state) {
+        writer.reset();
+        writer.startConstructed(0xBF0C).startConstructed(0xE0);
+
+        for (int64_t i = 0; i < records; i++) {
+            writer.startConstructed(0xE1).add(0xC1, RECORD_ID).add(0xC2, RECORD_DATA)
+                  .endConstructed();
+        }
+
+        writer.endConstructed().endConstructed();
+        size = writer.size();
+        benchmark::DoNotOptimize(writer.getBytes().data());
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_BuildTlv_Writer)->TLV_RECORDS;
+
+/**
+ * Card responses of various shapes: Calypso FCI, list of records, EMV PPSE and EMV record, card
+ * verifiable certificate (long form lengths).
+ */
+static std::vector<std::vector<uint8_t>> makeCorpus()
+{
+    std::vector<std::vector<uint8_t>> corpus;
+
+    corpus.push_back(HexUtil::toByteArray(
+        "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C2005141001"));
+    corpus.push_back(HexUtil::toByteArray(
+        "E030C106200107021D01C106202009021D04C106206919091D01C106201008041D03C10620401D021D01C106"
+        "20501E021D01"));
+    corpus.push_back(HexUtil::toByteArray(
+        "6F2F840E325041592E5359532E4444463031A51DBF0C1A61184F07A0000000041010500A4D41535445524341"
+        "5244870101"));
+    corpus.push_back(HexUtil::toByteArray(
+        "7081A257125413330089600010D25122010000000000005F200F4D4153544552434152442F434152449F1F08"
+        "30303030303030305F24032512315A0854133300896000105F3401018C159F02069F03069F1A0295055F2A02"
+        "9A039C019F37048D178A029F02069F03069F1A0295055F2A029A039C019F37048E0E00000000000000004203"
+        "1E031F039F0702FF009F0D05B0602400009F0E0500000000009F0F05B060249800"));
+
+    BerTlvWriter writer;
+    writer.startConstructed(0x7F21)
+          .startConstructed(0x7F4E)
+          .add(0x5F29, HexUtil::toByteArray("00"))
+          .add(0x42, HexUtil::toByteArray("4445435643413030303031"))
+          .startConstructed(0x7F49)
+          .add(0x06, HexUtil::toByteArray("04007F00070202020203"))
+          .add(0x86, std::vector<uint8_t>(65, 0x04))
+          .endConstructed()
+          .add(0x5F20, HexUtil::toByteArray("444554455354415431"))
+          .add(0x5F25, HexUtil::toByteArray("010200010001"))
+          .add(0x5F24, HexUtil::toByteArray("010500010001"))
+          .endConstructed()
+          .add(0x5F37, std::vector<uint8_t>(256, 0x5A))
+          .endConstructed();
+    corpus.push_back(writer.getBytes());
+
+    return corpus;
+}
+
+static void BM_ParseTlvCorpus(benchmark::State& state)
+{
+    const std::vector<std::vector<uint8_t>> corpus = makeCorpus();
+    size_t size = 0;
+
+    for (const auto& tlvStructure : corpus) {
+        size += tlvStructure.size();
+    }
+
+    for (auto _ : state) {
+        for (const auto& tlvStructure : corpus) {
+            benchmark::DoNotOptimize(BerTlvUtil::parse(tlvStructure, false));
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_ParseTlvCorpus);
+
+static void BM_ParseSimpleTlvCorpus(benchmark::State& state)
+{
+    const std::vector<std::vector<uint8_t>> corpus = makeCorpus();
+    size_t size = 0;
+
+    for (const auto& tlvStructure : corpus) {
+        size += tlvStructure.size();
+    }
+
+    for (auto _ : state) {
+        for (const auto& tlvStructure : corpus) {
+            benchmark::DoNotOptimize(BerTlvUtil::parseSimple(tlvStructure, true));
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_ParseSimpleTlvCorpus);
+
+/**
+ * Truncated or corrupted card responses, as found in field traffic.
+ */
+static std::vector<std::vector<uint8_t>> makeMalformedCorpus()
+{
+    std::vector<std::vector<uint8_t>> corpus;
+
+    /* Truncated FCI, invalid length field, child beyond its parent, tag too long, empty */
+    corpus.push_back(HexUtil::toByteArray(
+        "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C20051410"));
+    corpus.push_back(HexUtil::toByteArray("6F2F840E325041592E5359532E4444463031A58A"));
+    corpus.push_back(HexUtil::toByteArray("E030C106200107021D01C10F202009021D04"));
+    corpus.push_back(HexUtil::toByteArray("7081A25712DF81828301AA"));
+    corpus.push_back(HexUtil::toByteArray("8401AAE000"));
+
+    return corpus;
+}
+
+static void BM_ParseMalformedTlv_Exception(benchmark::State& state)
+{
+    const std::vector<std::vector<uint8_t>> corpus = makeMalformedCorpus();
+    int64_t errors = 0;
+
+    for (auto _ : state) {
+        for (const auto& tlvStructure : corpus) {
+            try {
+                benchmark::DoNotOptimize(BerTlvUtil::parse(tlvStructure, false));
+            } catch (const IllegalArgumentException& e) {
+                (void)e;
+                errors++;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(errors);
+}
+BENCHMARK(BM_ParseMalformedTlv_Exception);
+
+static void BM_ParseMalformedTlv_Result(benchmark::State& state)
+{
+    const std::vector<std::vector<uint8_t>> corpus = makeMalformedCorpus();
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+    int64_t errors = 0;
+
+    for (auto _ : state) {
+        for (const auto& tlvStructure : corpus) {
+            const BerTlvUtil::ParseResult result =
+                BerTlvUtil::tryParse(tlvStructure, false, tlvs);
+            if (result.error != BerTlvReader::Error::NONE) {
+                errors++;
+            }
+        }
+    }
+
+    state.SetItemsProcessed(errors);
+}
+BENCHMARK(BM_ParseMalformedTlv_Result);
+
+static const std::vector<uint8_t> PPSE_RESPONSE = HexUtil::toByteArray(
+    "6F2F840E325041592E5359532E4444463031A51DBF0C1A61184F07A0000000041010500A4D41535445524341"
+    "5244870101");
+
+static void BM_FindTlvPath_Parse(benchmark::State& state)
+{
+    for (auto _ : state) {
+        const auto tlvs = BerTlvUtil::parse(PPSE_RESPONSE, true);
+        benchmark::DoNotOptimize(tlvs.at(0x4F).front().data());
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FindTlvPath_Parse);
+
+static void BM_FindTlvPath_Compiled(benchmark::State& state)
+{
+    const BerTlvPath path("6F/A5/BF0C/61/4F");
+    BerTlvReader::Tlv tlv;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(path.find(PPSE_RESPONSE, tlv));
+    }
+
+    state.SetItemsProcessed(static_cast<int64_t>(state.iterations()));
+}
+BENCHMARK(BM_FindTlvPath_Compiled);
+
+static void BM_ParseTlvCorpus_MonotonicBuffer(benchmark::State& state)
+{
+    const std::vector<std::vector<uint8_t>> corpus = makeCorpus();
+    MonotonicBuffer buffer;
+    size_t size = 0;
+
+    for (const auto& tlvStructure : corpus) {
+        size += tlvStructure.size();
+    }
+
+    for (auto _ : state) {
+        for (const auto& tlvStructure : corpus) {
+            {
+                const BerTlvUtil::ArenaMap tlvs = BerTlvUtil::parse(tlvStructure, false, buffer);
+                benchmark::DoNotOptimize(tlvs.size());
+            }
+            buffer.release();
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations() * size));
+}
+BENCHMARK(BM_ParseTlvCorpus_MonotonicBuffer);
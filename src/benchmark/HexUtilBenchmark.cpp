@@ -0,0 +1,111 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+#include <sstream>
+
+#include "HexUtil.h"
+
+using namespace keyple::core::util;
+
+/**
+ * Byte array to hex string conversion as implemented up to 2.3.0 (one stream insertion per byte),
+ * kept as the reference.
+ */
+static const std::string legacyToHex(const std::vector<uint8_t>& tab)
+{
+    static const char digits[] = "0123456789ABCDEF";
+    static std::vector<std::string> byteToHex;
+
+    if (byteToHex.empty()) {
+        for (int i = 0; i < 256; i++) {
+            byteToHex.push_back(std::string({digits[i >> 4], digits[i & 0x0F]}));
+        }
+    }
+
+    std::stringstream ss;
+
+    for (const auto& b : tab) {
+        ss << (byteToHex[b & 0xFF]);
+    }
+
+    return ss.str();
+}
+
+static std::vector<uint8_t> makeInput(const size_t length)
+{
+    std::vector<uint8_t> tab(length);
+
+    for (size_t i = 0; i < length; i++) {
+        tab[i] = static_cast<uint8_t>(i * 31 + 7);
+    }
+
+    return tab;
+}
+
+/*
+ * Sizes range from a short APDU header (5 bytes) to a 64 KiB memory dump; throughput is reported
+ * as input bytes per second.
+ */
+#define HEX_SIZES Arg(5)->Arg(16)->Arg(64)->Arg(261)->Arg(1024)->Arg(4096)->Arg(65536)
+
+static void BM_ToHex_Legacy(benchmark::State& state)
+{
+    const std::vector<uint8_t> tab = makeInput(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(legacyToHex(tab));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ToHex_Legacy)->HEX_SIZES;
+
+static void BM_ToHex(benchmark::State& state)
+{
+    const std::vector<uint8_t> tab = makeInput(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HexUtil::toHex(tab));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+BENCHMARK(BM_ToHex)->HEX_SIZES;
+
+static void BM_IsValidAndToByteArray(benchmark::State& state)
+{
+    const std::string hex = HexUtil::toHex(makeInput(static_cast<size_t>(state.range(0))));
+
+    for (auto _ : state) {
+        if (HexUtil::isValid(hex)) {
+            benchmark::DoNotOptimize(HexUtil::toByteArray(hex));
+        }
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK(BM_IsValidAndToByteArray)->HEX_SIZES;
+
+static void BM_Decode(benchmark::State& state)
+{
+    const std::string hex = HexUtil::toHex(makeInput(static_cast<size_t>(state.range(0))));
+    std::vector<uint8_t> tab;
+
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(HexUtil::decode(hex, tab));
+    }
+
+    state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * state.range(0) * 2);
+}
+BENCHMARK(BM_Decode)->HEX_SIZES;
@@ -0,0 +1,117 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "benchmark/benchmark.h"
+
+#include <cstdio>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "Logger.h"
+#include "LoggerFactory.h"
+
+using namespace keyple::core::util::cpp;
+
+/*
+ * Log-call latency seen by 8 to 32 reader threads, the log output being sent to /dev/null so that
+ * the terminal doesn't weigh on the measure (the benchmark results being printed once stdout is
+ * restored).
+ */
+#define LOG_THREADS Threads(8)->Threads(16)->Threads(32)->UseRealTime()
+
+static const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(Logger));
+
+static int savedStdout = -1;
+
+static void setUp(const bool async, const bool binary)
+{
+    std::fflush(stdout);
+    savedStdout = dup(fileno(stdout));
+
+    const int devNull = open("/dev/null", O_WRONLY);
+    dup2(devNull, fileno(stdout));
+    close(devNull);
+
+    Logger::setLoggerLevel(Logger::Level::logInfo);
+    Logger::setAsyncMode(async, 65536);
+    Logger::setBinaryMode(binary);
+}
+
+static void tearDown()
+{
+    Logger::setAsyncMode(false);
+    Logger::setBinaryMode(false);
+    std::fflush(stdout);
+
+    dup2(savedStdout, fileno(stdout));
+    close(savedStdout);
+}
+
+static void runLogCalls(benchmark::State& state, const bool async)
+{
+    if (state.thread_index() == 0) {
+        setUp(async, false);
+    }
+
+    const std::string apdu = "00B2011C1D";
+    int i = 0;
+
+    for (auto _ : state) {
+        logger->info("[%] apdu: %, record %\n", state.thread_index(), apdu, i++);
+    }
+
+    if (state.thread_index() == 0) {
+        tearDown();
+    }
+}
+
+static void runMacroLogCalls(benchmark::State& state, const bool binary)
+{
+    if (state.thread_index() == 0) {
+        setUp(true, binary);
+    }
+
+    const std::string apdu = "00B2011C1D";
+    int i = 0;
+
+    for (auto _ : state) {
+        KEYPLE_LOG_INFO(logger, "[%] apdu: %, record %\n", state.thread_index(), apdu, i++);
+    }
+
+    if (state.thread_index() == 0) {
+        tearDown();
+    }
+}
+
+static void BM_LogCall_Sync(benchmark::State& state)
+{
+    runLogCalls(state, false);
+}
+BENCHMARK(BM_LogCall_Sync)->LOG_THREADS;
+
+static void BM_LogCall_Async(benchmark::State& state)
+{
+    runLogCalls(state, true);
+}
+BENCHMARK(BM_LogCall_Async)->LOG_THREADS;
+
+static void BM_LogCall_AsyncFormatMacro(benchmark::State& state)
+{
+    runMacroLogCalls(state, false);
+}
+BENCHMARK(BM_LogCall_AsyncFormatMacro)->LOG_THREADS;
+
+static void BM_LogCall_AsyncBinary(benchmark::State& state)
+{
+    runMacroLogCalls(state, true);
+}
+BENCHMARK(BM_LogCall_AsyncBinary)->LOG_THREADS;
@@ -0,0 +1,153 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "ApduBatch.h"
+
+#include <cstring>
+
+/* Keyple Core Util */
+#include "ApduUtil.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+ApduBatch::ApduBatch(const size_t capacity, const size_t commandCapacity)
+{
+    mBuffer.reserve(capacity);
+    mOffsets.reserve(commandCapacity + 1);
+    mOffsets.push_back(0);
+}
+
+ApduBatch& ApduBatch::add(const uint8_t cla,
+                          const uint8_t ins,
+                          const uint8_t p1,
+                          const uint8_t p2,
+                          const uint8_t* dataIn,
+                          const size_t dataInLength,
+                          const uint8_t le)
+{
+    uint8_t* const apduCommand = prepare(dataInLength + 6);
+
+    try {
+        commit(ApduUtil::write(cla, ins, p1, p2, dataIn, dataInLength, le, apduCommand));
+    } catch (...) {
+        /* The commands already added are kept as is */
+        rollback();
+        throw;
+    }
+
+    return *this;
+}
+
+ApduBatch& ApduBatch::add(const uint8_t cla,
+                          const uint8_t ins,
+                          const uint8_t p1,
+                          const uint8_t p2,
+                          const uint8_t* dataIn,
+                          const size_t dataInLength)
+{
+    uint8_t* const apduCommand = prepare(dataInLength + 5);
+
+    try {
+        commit(ApduUtil::write(cla, ins, p1, p2, dataIn, dataInLength, apduCommand));
+    } catch (...) {
+        /* The commands already added are kept as is */
+        rollback();
+        throw;
+    }
+
+    return *this;
+}
+
+ApduBatch& ApduBatch::add(const uint8_t cla,
+                          const uint8_t ins,
+                          const uint8_t p1,
+                          const uint8_t p2,
+                          const uint8_t le)
+{
+    return add(cla, ins, p1, p2, nullptr, 0, le);
+}
+
+ApduBatch& ApduBatch::add(const uint8_t cla, const uint8_t ins, const uint8_t p1, const uint8_t p2)
+{
+    return add(cla, ins, p1, p2, nullptr, 0);
+}
+
+ApduBatch& ApduBatch::add(const uint8_t* apduCommand, const size_t length)
+{
+    std::memcpy(prepare(length), apduCommand, length);
+    commit(length);
+
+    return *this;
+}
+
+ApduBatch& ApduBatch::add(const std::vector<uint8_t>& apduCommand)
+{
+    return add(apduCommand.data(), apduCommand.size());
+}
+
+size_t ApduBatch::size() const
+{
+    return mOffsets.size() - 1;
+}
+
+const uint8_t* ApduBatch::getCommand(const size_t index) const
+{
+    return mBuffer.data() + mOffsets[index];
+}
+
+size_t ApduBatch::getCommandLength(const size_t index) const
+{
+    return mOffsets[index + 1] - mOffsets[index];
+}
+
+const std::vector<uint8_t>& ApduBatch::getBytes() const
+{
+    return mBuffer;
+}
+
+const std::vector<size_t>& ApduBatch::getOffsets() const
+{
+    return mOffsets;
+}
+
+void ApduBatch::reset()
+{
+    mBuffer.clear();
+    mOffsets.resize(1);
+}
+
+uint8_t* ApduBatch::prepare(const size_t maxLength)
+{
+    const size_t offset = mOffsets.back();
+    mBuffer.resize(offset + maxLength);
+
+    return mBuffer.data() + offset;
+}
+
+void ApduBatch::commit(const size_t length)
+{
+    const size_t end = mOffsets.back() + length;
+
+    mBuffer.resize(end);
+    mOffsets.push_back(end);
+}
+
+void ApduBatch::rollback()
+{
+    mBuffer.resize(mOffsets.back());
+}
+
+}
+}
+}
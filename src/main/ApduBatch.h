@@ -0,0 +1,226 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Batch of APDU commands packed one after the other into a single buffer.
+ *
+ * <p>The commands of a transaction are written with the same rules as {@link ApduUtil}, with no
+ * allocation per command, and are located by an index of offsets: command i spans {@link
+ * #getOffsets()}[i] to {@link #getOffsets()}[i + 1], the buffer itself being suitable for vectored
+ * I/O.
+ *
+ * <p>The buffer and the index are kept by {@link #reset()}, so that a batch can be reused from one
+ * card session to the next without reallocation.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API ApduBatch final {
+public:
+    /**
+     * Creates a batch.
+     *
+     * @param capacity The initial capacity of the buffer, in bytes.
+     * @param commandCapacity The initial capacity of the index, in commands.
+     * @since 2.4.0
+     */
+    explicit ApduBatch(const size_t capacity = 1024, const size_t commandCapacity = 32);
+
+    /**
+     * Adds an APDU command (case 4, or case 2 without data).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @return The current instance.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const uint8_t cla,
+                   const uint8_t ins,
+                   const uint8_t p1,
+                   const uint8_t p2,
+                   const uint8_t* dataIn,
+                   const size_t dataInLength,
+                   const uint8_t le);
+
+    /**
+     * Adds an APDU command (case 3, or case 1 without data).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @return The current instance.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const uint8_t cla,
+                   const uint8_t ins,
+                   const uint8_t p1,
+                   const uint8_t p2,
+                   const uint8_t* dataIn,
+                   const size_t dataInLength);
+
+    /**
+     * Adds an APDU command (case 2).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const uint8_t cla,
+                   const uint8_t ins,
+                   const uint8_t p1,
+                   const uint8_t p2,
+                   const uint8_t le);
+
+    /**
+     * Adds an APDU command (case 1).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const uint8_t cla, const uint8_t ins, const uint8_t p1, const uint8_t p2);
+
+    /**
+     * Adds an already built APDU command.
+     *
+     * @param apduCommand The command.
+     * @param length The length of the command.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const uint8_t* apduCommand, const size_t length);
+
+    /**
+     * Adds an already built APDU command.
+     *
+     * @param apduCommand The command.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduBatch& add(const std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Gets the number of commands.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    size_t size() const;
+
+    /**
+     * Gets a command.
+     *
+     * @param index The position of the command in the batch.
+     * @return A pointer into the buffer of the batch, valid until the next modification.
+     * @since 2.4.0
+     */
+    const uint8_t* getCommand(const size_t index) const;
+
+    /**
+     * Gets the length of a command.
+     *
+     * @param index The position of the command in the batch.
+     * @return The length of the command, in bytes.
+     * @since 2.4.0
+     */
+    size_t getCommandLength(const size_t index) const;
+
+    /**
+     * Gets the commands, packed one after the other.
+     *
+     * @return A reference to the buffer of the batch, valid until the next modification.
+     * @since 2.4.0
+     */
+    const std::vector<uint8_t>& getBytes() const;
+
+    /**
+     * Gets the offsets of the commands in the buffer, followed by the total length.
+     *
+     * @return A reference to the index of the batch ({@link #size()} + 1 entries), valid until the
+     *         next modification.
+     * @since 2.4.0
+     */
+    const std::vector<size_t>& getOffsets() const;
+
+    /**
+     * Discards the commands added so far, keeping the buffer and index capacities.
+     *
+     * @since 2.4.0
+     */
+    void reset();
+
+private:
+    /**
+     *
+     */
+    std::vector<uint8_t> mBuffer;
+
+    /**
+     * Offset of each command, followed by the end of the last one
+     */
+    std::vector<size_t> mOffsets;
+
+    /**
+     * (private)<br>
+     * Grows the buffer by the maximum length of the command to be written.
+     *
+     * @return The destination of the command.
+     */
+    uint8_t* prepare(const size_t maxLength);
+
+    /**
+     * (private)<br>
+     * Shrinks the buffer to the actual end of the command written and indexes it.
+     */
+    void commit(const size_t length);
+
+    /**
+     * (private)<br>
+     * Shrinks the buffer back to the end of the last command, after a failed write.
+     */
+    void rollback();
+};
+
+}
+}
+}
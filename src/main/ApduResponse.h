@@ -0,0 +1,209 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Read-only view of an APDU response (data field followed by SW1 SW2), the counterpart of {@link
+ * ApduUtil} for responses.
+ *
+ * <p>Nothing is copied nor allocated: the view only points to the response buffer, which must
+ * therefore outlive it. All the accessors are constexpr, so that a view of a constant response can
+ * be checked at compile time:
+ *
+ * <pre>
+ * static constexpr uint8_t RESPONSE[] = {0x12, 0x34, 0x90, 0x00};
+ * static_assert(ApduResponse(RESPONSE, sizeof(RESPONSE)).isSuccess(), "");
+ * </pre>
+ *
+ * <p>A response shorter than 2 bytes is reported as invalid, with an empty data field and a
+ * status word set to 0.
+ *
+ * @since 2.4.0
+ */
+class ApduResponse final {
+public:
+    /**
+     * Creates a view of a response.
+     *
+     * @param apduResponse The response, must outlive the view.
+     * @param length The length of the response, status word included.
+     * @since 2.4.0
+     */
+    constexpr ApduResponse(const uint8_t* apduResponse, const size_t length)
+    : mApduResponse(apduResponse), mLength(length) {}
+
+    /**
+     * Creates a view of a response.
+     *
+     * @param apduResponse The response, must outlive the view.
+     * @since 2.4.0
+     */
+    explicit ApduResponse(const std::vector<uint8_t>& apduResponse)
+    : ApduResponse(apduResponse.data(), apduResponse.size()) {}
+
+    /**
+     * Indicates if the response contains a status word.
+     *
+     * @return True if the response is at least 2 bytes long.
+     * @since 2.4.0
+     */
+    constexpr bool isValid() const
+    {
+        return mLength >= 2;
+    }
+
+    /**
+     * Gets the data field.
+     *
+     * @return A pointer into the response buffer.
+     * @since 2.4.0
+     */
+    constexpr const uint8_t* getData() const
+    {
+        return mApduResponse;
+    }
+
+    /**
+     * Gets the length of the data field.
+     *
+     * @return 0 if the response has no data field.
+     * @since 2.4.0
+     */
+    constexpr size_t getDataLength() const
+    {
+        return isValid() ? mLength - 2 : 0;
+    }
+
+    /**
+     * Gets the first byte of the status word.
+     *
+     * @return 0 if the response is invalid.
+     * @since 2.4.0
+     */
+    constexpr uint8_t getSw1() const
+    {
+        return isValid() ? mApduResponse[mLength - 2] : 0;
+    }
+
+    /**
+     * Gets the second byte of the status word.
+     *
+     * @return 0 if the response is invalid.
+     * @since 2.4.0
+     */
+    constexpr uint8_t getSw2() const
+    {
+        return isValid() ? mApduResponse[mLength - 1] : 0;
+    }
+
+    /**
+     * Gets the status word.
+     *
+     * @return The status word (e.g. 0x9000), 0 if the response is invalid.
+     * @since 2.4.0
+     */
+    constexpr uint16_t getStatusWord() const
+    {
+        return static_cast<uint16_t>((getSw1() << 8) | getSw2());
+    }
+
+    /**
+     * Indicates if the command has been successfully processed (9000h, or 61xx meaning that more
+     * data is available).
+     *
+     * @return True for a normal processing status word.
+     * @since 2.4.0
+     */
+    constexpr bool isSuccess() const
+    {
+        return getStatusWord() == 0x9000 || getSw1() == 0x61;
+    }
+
+    /**
+     * Indicates if the command has been processed with a warning (62xx or 63xx).
+     *
+     * @return True for a warning processing status word.
+     * @since 2.4.0
+     */
+    constexpr bool isWarning() const
+    {
+        return getSw1() == 0x62 || getSw1() == 0x63;
+    }
+
+    /**
+     * Indicates if the command has failed during its execution (64xx to 66xx).
+     *
+     * @return True for an execution error status word.
+     * @since 2.4.0
+     */
+    constexpr bool isExecutionError() const
+    {
+        return getSw1() >= 0x64 && getSw1() <= 0x66;
+    }
+
+    /**
+     * Indicates if the command has been rejected by the card (67xx to 6Fxx).
+     *
+     * @return True for a checking error status word.
+     * @since 2.4.0
+     */
+    constexpr bool isCheckingError() const
+    {
+        return getSw1() >= 0x67 && getSw1() <= 0x6F;
+    }
+
+    /**
+     * Indicates if more data is available with a GET RESPONSE command (61xx).
+     *
+     * @return True if SW1 is 61h, SW2 then giving the number of bytes available.
+     * @since 2.4.0
+     */
+    constexpr bool hasMoreData() const
+    {
+        return getSw1() == 0x61;
+    }
+
+    /**
+     * Indicates if the command has to be sent again with the Le given by SW2 (6Cxx).
+     *
+     * @return True if SW1 is 6Ch.
+     * @since 2.4.0
+     */
+    constexpr bool isWrongLe() const
+    {
+        return getSw1() == 0x6C;
+    }
+
+private:
+    /**
+     *
+     */
+    const uint8_t* mApduResponse;
+
+    /**
+     *
+     */
+    size_t mLength;
+};
+
+}
+}
+}
@@ -0,0 +1,108 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "ApduResponseAssembler.h"
+
+#include <algorithm>
+
+/* Keyple Core Util */
+#include "ApduResponse.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+const uint8_t ApduResponseAssembler::INS_GET_RESPONSE;
+
+ApduResponseAssembler::ApduResponseAssembler(const size_t capacity)
+: mLe(0), mComplete(false)
+{
+    mBuffer.reserve(capacity);
+}
+
+ApduResponseAssembler::Action ApduResponseAssembler::add(const uint8_t* apduResponse,
+                                                         const size_t length)
+{
+    const ApduResponse response(apduResponse, length);
+
+    if (!response.isValid()) {
+        throw IllegalArgumentException("APDU response without status word.");
+    }
+
+    if (mComplete) {
+        throw IllegalStateException("APDU response already complete.");
+    }
+
+    const size_t dataLength = response.getDataLength();
+    const uint8_t sw2 = response.getSw2();
+
+    if (response.hasMoreData()) {
+        /* Room is made for the data available (SW2 = 0 standing for 256 bytes), growing
+           geometrically so that a long chain of responses is not copied at each step */
+        const size_t needed = mBuffer.size() + dataLength + (sw2 == 0 ? 256 : sw2) + 2;
+        if (needed > mBuffer.capacity()) {
+            mBuffer.reserve(std::max(2 * mBuffer.capacity(), needed));
+        }
+        mBuffer.insert(mBuffer.end(), apduResponse, apduResponse + dataLength);
+        mLe = sw2;
+        return Action::GET_RESPONSE;
+    }
+
+    if (response.isWrongLe()) {
+        /* The response doesn't carry data */
+        mLe = sw2;
+        return Action::RESEND;
+    }
+
+    mBuffer.insert(mBuffer.end(), apduResponse, apduResponse + length);
+    mComplete = true;
+    return Action::COMPLETE;
+}
+
+ApduResponseAssembler::Action ApduResponseAssembler::add(const std::vector<uint8_t>& apduResponse)
+{
+    return add(apduResponse.data(), apduResponse.size());
+}
+
+uint8_t ApduResponseAssembler::getLe() const
+{
+    return mLe;
+}
+
+bool ApduResponseAssembler::isComplete() const
+{
+    return mComplete;
+}
+
+const std::vector<uint8_t>& ApduResponseAssembler::getApduResponse() const
+{
+    if (!mComplete) {
+        throw IllegalStateException("APDU response not complete.");
+    }
+
+    return mBuffer;
+}
+
+void ApduResponseAssembler::reset()
+{
+    mBuffer.clear();
+    mLe = 0;
+    mComplete = false;
+}
+
+}
+}
+}
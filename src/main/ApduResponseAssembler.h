@@ -0,0 +1,159 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Reassembler of APDU responses split by the card (ISO 7816-4 61xx and 6Cxx status words).
+ *
+ * <p>Each response received is passed to {@link #add(const uint8_t*, const size_t)}, which tells
+ * the caller what to send next:
+ *
+ * <ul>
+ *   <li>61xx: the data is kept and xx more bytes are available, a GET RESPONSE command (INS C0h)
+ *       with Le = xx has to be sent.
+ *   <li>6Cxx: the command has to be sent again with Le = xx.
+ *   <li>any other status word ends the sequence, the assembled response (data of all the
+ *       responses followed by the last status word) is then available.
+ * </ul>
+ *
+ * <p>The data is appended into a single buffer, grown ahead of the announced 61xx lengths and kept
+ * by {@link #reset()}, so that an assembler can be reused without reallocation.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API ApduResponseAssembler final {
+public:
+    /**
+     * What has to be sent to the card after a response.
+     *
+     * @since 2.4.0
+     */
+    enum class Action {
+        /**
+         * Nothing, the response is complete.
+         */
+        COMPLETE,
+
+        /**
+         * A GET RESPONSE command with Le set to {@link #getLe()}.
+         */
+        GET_RESPONSE,
+
+        /**
+         * The last command again, with Le set to {@link #getLe()}.
+         */
+        RESEND
+    };
+
+    /**
+     * Instruction byte of the GET RESPONSE command.
+     *
+     * @since 2.4.0
+     */
+    static const uint8_t INS_GET_RESPONSE = 0xC0;
+
+    /**
+     * Creates an assembler.
+     *
+     * @param capacity The initial capacity of the buffer, in bytes.
+     * @since 2.4.0
+     */
+    explicit ApduResponseAssembler(const size_t capacity = 258);
+
+    /**
+     * Adds a response received from the card.
+     *
+     * @param apduResponse The response, status word included.
+     * @param length The length of the response.
+     * @return The action expected from the caller.
+     * @throw IllegalArgumentException If the response is shorter than a status word.
+     * @throw IllegalStateException If the response is already complete.
+     * @since 2.4.0
+     */
+    Action add(const uint8_t* apduResponse, const size_t length);
+
+    /**
+     * Adds a response received from the card.
+     *
+     * @param apduResponse The response, status word included.
+     * @return The action expected from the caller.
+     * @throw IllegalArgumentException If the response is shorter than a status word.
+     * @throw IllegalStateException If the response is already complete.
+     * @since 2.4.0
+     */
+    Action add(const std::vector<uint8_t>& apduResponse);
+
+    /**
+     * Gets the Le of the next command, as indicated by the last 61xx or 6Cxx status word.
+     *
+     * @return The Le byte (0 standing for 256).
+     * @since 2.4.0
+     */
+    uint8_t getLe() const;
+
+    /**
+     * Indicates if the response is complete.
+     *
+     * @return True if a final status word has been received.
+     * @since 2.4.0
+     */
+    bool isComplete() const;
+
+    /**
+     * Gets the assembled response.
+     *
+     * @return A reference to the buffer of the assembler (data followed by the final status word),
+     *         valid until the next modification.
+     * @throw IllegalStateException If the response is not complete.
+     * @since 2.4.0
+     */
+    const std::vector<uint8_t>& getApduResponse() const;
+
+    /**
+     * Discards the data received so far, keeping the buffer capacity.
+     *
+     * @since 2.4.0
+     */
+    void reset();
+
+private:
+    /**
+     * Data received so far, followed by the final status word once complete
+     */
+    std::vector<uint8_t> mBuffer;
+
+    /**
+     *
+     */
+    uint8_t mLe;
+
+    /**
+     *
+     */
+    bool mComplete;
+};
+
+}
+}
+}
@@ -0,0 +1,193 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "ApduTemplate.h"
+
+#include <cstring>
+
+/* Keyple Core Util */
+#include "ApduUtil.h"
+#include "ArrayIndexOutOfBoundsException.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+ApduTemplate::ApduTemplate(const uint8_t* apduCommand, const size_t length)
+: mApdu(apduCommand, apduCommand + length), mDataOffset(0), mDataLength(0), mLeOffset(0)
+{
+    locateFields();
+}
+
+ApduTemplate::ApduTemplate(const std::vector<uint8_t>& apduCommand)
+: ApduTemplate(apduCommand.data(), apduCommand.size()) {}
+
+ApduTemplate::ApduTemplate(const uint8_t cla,
+                           const uint8_t ins,
+                           const uint8_t p1,
+                           const uint8_t p2,
+                           const uint8_t* dataIn,
+                           const size_t dataInLength,
+                           const uint8_t le)
+: mDataOffset(0), mDataLength(0), mLeOffset(0)
+{
+    ApduUtil::write(cla, ins, p1, p2, dataIn, dataInLength, le, mApdu);
+    locateFields();
+}
+
+ApduTemplate::ApduTemplate(const uint8_t cla,
+                           const uint8_t ins,
+                           const uint8_t p1,
+                           const uint8_t p2,
+                           const uint8_t* dataIn,
+                           const size_t dataInLength)
+: mDataOffset(0), mDataLength(0), mLeOffset(0)
+{
+    if (dataInLength == 0) {
+        throw IllegalArgumentException("Case 3 template without data.");
+    }
+
+    ApduUtil::write(cla, ins, p1, p2, dataIn, dataInLength, mApdu);
+    locateFields();
+}
+
+void ApduTemplate::locateFields()
+{
+    switch (ApduUtil::getCase(mApdu)) {
+    case ApduUtil::ApduCase::CASE_1:
+    case ApduUtil::ApduCase::CASE_2E:
+        break;
+    case ApduUtil::ApduCase::CASE_2:
+        mLeOffset = 4;
+        break;
+    case ApduUtil::ApduCase::CASE_3:
+        mDataOffset = 5;
+        mDataLength = mApdu.size() - 5;
+        break;
+    case ApduUtil::ApduCase::CASE_4:
+        mDataOffset = 5;
+        mDataLength = mApdu.size() - 6;
+        mLeOffset = mApdu.size() - 1;
+        break;
+    case ApduUtil::ApduCase::CASE_3E:
+        mDataOffset = 7;
+        mDataLength = mApdu.size() - 7;
+        break;
+    case ApduUtil::ApduCase::CASE_4E:
+        mDataOffset = 7;
+        mDataLength = mApdu.size() - 9;
+        break;
+    default:
+        throw IllegalArgumentException("Malformed APDU command.");
+    }
+}
+
+ApduTemplate& ApduTemplate::setCla(const uint8_t cla)
+{
+    mApdu[0] = cla;
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setP1(const uint8_t p1)
+{
+    mApdu[2] = p1;
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setP2(const uint8_t p2)
+{
+    mApdu[3] = p2;
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setP1P2(const uint16_t p1p2)
+{
+    mApdu[2] = static_cast<uint8_t>(p1p2 >> 8);
+    mApdu[3] = static_cast<uint8_t>(p1p2);
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setLe(const uint8_t le)
+{
+    if (mLeOffset == 0) {
+        throw IllegalStateException("No short Le field in the APDU command.");
+    }
+
+    mApdu[mLeOffset] = le;
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setDataByte(const size_t offset, const uint8_t value)
+{
+    *getData(offset, 1) = value;
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setDataShort(const size_t offset, const uint16_t value)
+{
+    uint8_t* const data = getData(offset, 2);
+    data[0] = static_cast<uint8_t>(value >> 8);
+    data[1] = static_cast<uint8_t>(value);
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setDataInt(const size_t offset, const uint32_t value)
+{
+    uint8_t* const data = getData(offset, 4);
+    data[0] = static_cast<uint8_t>(value >> 24);
+    data[1] = static_cast<uint8_t>(value >> 16);
+    data[2] = static_cast<uint8_t>(value >> 8);
+    data[3] = static_cast<uint8_t>(value);
+
+    return *this;
+}
+
+ApduTemplate& ApduTemplate::setData(const size_t offset, const uint8_t* value, const size_t length)
+{
+    std::memcpy(getData(offset, length), value, length);
+
+    return *this;
+}
+
+size_t ApduTemplate::getDataLength() const
+{
+    return mDataLength;
+}
+
+const std::vector<uint8_t>& ApduTemplate::getBytes() const
+{
+    return mApdu;
+}
+
+uint8_t* ApduTemplate::getData(const size_t offset, const size_t length)
+{
+    if (offset > mDataLength || length > mDataLength - offset) {
+        throw ArrayIndexOutOfBoundsException("offset + length > data field size");
+    }
+
+    return mApdu.data() + mDataOffset + offset;
+}
+
+}
+}
+}
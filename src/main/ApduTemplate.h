@@ -0,0 +1,256 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * APDU command serialized once, whose variable fields are then patched in place before each
+ * sending.
+ *
+ * <p>Most commands of a transaction only differ by P1/P2 (e.g. a record number) or a few data
+ * bytes. The constant parts are serialized when the template is created, possibly from a command
+ * converted at compile time by {@link HexLiteral}, and the setters only overwrite the bytes of the
+ * variable fields:
+ *
+ * <pre>
+ * static constexpr std::array<uint8_t, 5> READ_RECORD = HexLiteral::toByteArray("00B2000400");
+ * ApduTemplate readRecord(READ_RECORD.data(), READ_RECORD.size());
+ * readRecord.setP1(recordNumber).setLe(29);
+ * </pre>
+ *
+ * <p>The structure of the command (case, Lc, data length) can't be changed. Short and extended
+ * commands are supported, Le being settable on short commands only.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API ApduTemplate final {
+public:
+    /**
+     * Creates a template from an already built APDU command.
+     *
+     * @param apduCommand The command, copied.
+     * @param length The length of the command.
+     * @throw IllegalArgumentException If the command is not well formed.
+     * @since 2.4.0
+     */
+    ApduTemplate(const uint8_t* apduCommand, const size_t length);
+
+    /**
+     * Creates a template from an already built APDU command.
+     *
+     * @param apduCommand The command, copied.
+     * @throw IllegalArgumentException If the command is not well formed.
+     * @since 2.4.0
+     */
+    explicit ApduTemplate(const std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Creates a template of an APDU command (case 4, or case 2 without data).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The initial data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    ApduTemplate(const uint8_t cla,
+                 const uint8_t ins,
+                 const uint8_t p1,
+                 const uint8_t p2,
+                 const uint8_t* dataIn,
+                 const size_t dataInLength,
+                 const uint8_t le);
+
+    /**
+     * Creates a template of an APDU command (case 3).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The initial data field of the command.
+     * @param dataInLength The length of the data field (1 to 255).
+     * @throw IllegalArgumentException If dataInLength is 0 or greater than 255.
+     * @since 2.4.0
+     */
+    ApduTemplate(const uint8_t cla,
+                 const uint8_t ins,
+                 const uint8_t p1,
+                 const uint8_t p2,
+                 const uint8_t* dataIn,
+                 const size_t dataInLength);
+
+    /**
+     * Sets the class byte.
+     *
+     * @param cla The class byte.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduTemplate& setCla(const uint8_t cla);
+
+    /**
+     * Sets the parameter 1.
+     *
+     * @param p1 The parameter 1.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduTemplate& setP1(const uint8_t p1);
+
+    /**
+     * Sets the parameter 2.
+     *
+     * @param p2 The parameter 2.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduTemplate& setP2(const uint8_t p2);
+
+    /**
+     * Sets the parameters 1 and 2.
+     *
+     * @param p1p2 P1 (most significant byte) and P2 (least significant byte).
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    ApduTemplate& setP1P2(const uint16_t p1p2);
+
+    /**
+     * Sets the Le byte of a short command.
+     *
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @return The current instance.
+     * @throw IllegalStateException If the command has no short Le field.
+     * @since 2.4.0
+     */
+    ApduTemplate& setLe(const uint8_t le);
+
+    /**
+     * Sets a byte of the data field.
+     *
+     * @param offset The offset in the data field.
+     * @param value The value.
+     * @return The current instance.
+     * @throw ArrayIndexOutOfBoundsException If the byte is beyond the data field.
+     * @since 2.4.0
+     */
+    ApduTemplate& setDataByte(const size_t offset, const uint8_t value);
+
+    /**
+     * Sets 2 bytes of the data field (big endian).
+     *
+     * @param offset The offset in the data field.
+     * @param value The value.
+     * @return The current instance.
+     * @throw ArrayIndexOutOfBoundsException If the bytes are beyond the data field.
+     * @since 2.4.0
+     */
+    ApduTemplate& setDataShort(const size_t offset, const uint16_t value);
+
+    /**
+     * Sets 4 bytes of the data field (big endian).
+     *
+     * @param offset The offset in the data field.
+     * @param value The value.
+     * @return The current instance.
+     * @throw ArrayIndexOutOfBoundsException If the bytes are beyond the data field.
+     * @since 2.4.0
+     */
+    ApduTemplate& setDataInt(const size_t offset, const uint32_t value);
+
+    /**
+     * Sets bytes of the data field.
+     *
+     * @param offset The offset in the data field.
+     * @param value The bytes to copy.
+     * @param length The number of bytes to copy.
+     * @return The current instance.
+     * @throw ArrayIndexOutOfBoundsException If the bytes are beyond the data field.
+     * @since 2.4.0
+     */
+    ApduTemplate& setData(const size_t offset, const uint8_t* value, const size_t length);
+
+    /**
+     * Gets the length of the data field.
+     *
+     * @return 0 if the command has no data field.
+     * @since 2.4.0
+     */
+    size_t getDataLength() const;
+
+    /**
+     * Gets the command.
+     *
+     * @return A reference to the buffer of the template, valid until the template is destroyed.
+     * @since 2.4.0
+     */
+    const std::vector<uint8_t>& getBytes() const;
+
+private:
+    /**
+     *
+     */
+    std::vector<uint8_t> mApdu;
+
+    /**
+     * Offset of the data field in mApdu
+     */
+    size_t mDataOffset;
+
+    /**
+     *
+     */
+    size_t mDataLength;
+
+    /**
+     * Offset of the short Le field in mApdu, 0 if there is none
+     */
+    size_t mLeOffset;
+
+    /**
+     * (private)<br>
+     * Locates the data and Le fields of the command.
+     *
+     * @throw IllegalArgumentException If the command is not well formed.
+     */
+    void locateFields();
+
+    /**
+     * (private)<br>
+     * Checks that the bytes are within the data field and gets their location.
+     *
+     * @throw ArrayIndexOutOfBoundsException If the bytes are beyond the data field.
+     */
+    uint8_t* getData(const size_t offset, const size_t length);
+};
+
+}
+}
+}
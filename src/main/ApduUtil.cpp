@@ -12,14 +12,21 @@
 
 #include "ApduUtil.h"
 
+#include <cstring>
+#include <string>
+
 /* Util */
-#include "System.h"
+#include "IllegalArgumentException.h"
 
 namespace keyple {
 namespace core {
 namespace util {
 
-using namespace keyple::core::util::cpp;
+using namespace keyple::core::util::cpp::exception;
+
+const size_t ApduUtil::MAX_SHORT_DATA_LENGTH;
+const size_t ApduUtil::MAX_EXTENDED_DATA_LENGTH;
+const uint8_t ApduUtil::CLA_CHAINING_BIT;
 
 ApduUtil::ApduUtil() {}
 
@@ -30,27 +37,27 @@ const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
                                            const std::vector<uint8_t>& dataIn,
                                            const uint8_t le)
 {
-    std::vector<uint8_t> apduCommand;
+    return build(cla, ins, p1, p2, dataIn.data(), dataIn.size(), le);
+}
 
-    /* Buffer allocation */
-    apduCommand = allocateBuffer(dataIn, le);
+const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
+                                           const uint8_t ins,
+                                           const uint8_t p1,
+                                           const uint8_t p2,
+                                           const std::vector<uint8_t>& dataIn)
+{
+    return build(cla, ins, p1, p2, dataIn.data(), dataIn.size());
+}
 
-    /* Build APDU buffer from provided arguments */
-    apduCommand[0] = cla;
-    apduCommand[1] = ins;
-    apduCommand[2] = p1;
-    apduCommand[3] = p2;
+const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
+                                           const uint8_t ins,
+                                           const uint8_t p1,
+                                           const uint8_t p2,
+                                           const uint8_t le)
+{
+    std::vector<uint8_t> apduCommand;
 
-    /* ISO7618 case determination and Le management */
-    if (dataIn.size() != 0) {
-        /* Append Lc and ingoing data */
-        apduCommand[4] = static_cast<uint8_t>(dataIn.size());
-        System::arraycopy(dataIn, 0, apduCommand, 5, static_cast<int>(dataIn.size()));
-        apduCommand[apduCommand.size() - 1] = le;
-    } else {
-        /* Case2: outgoing data only */
-        apduCommand[4] = le;
-    }
+    write(cla, ins, p1, p2, le, apduCommand);
 
     return apduCommand;
 }
@@ -58,30 +65,12 @@ const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
 const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
                                            const uint8_t ins,
                                            const uint8_t p1,
-                                           const uint8_t p2,
-                                           const std::vector<uint8_t>& dataIn)
+                                           const uint8_t p2)
 {
     std::vector<uint8_t> apduCommand;
 
-    /* Buffer allocation */
-    apduCommand = allocateBuffer(dataIn);
-
-    /* Build APDU buffer from provided arguments */
-    apduCommand[0] = cla;
-    apduCommand[1] = ins;
-    apduCommand[2] = p1;
-    apduCommand[3] = p2;
+    write(cla, ins, p1, p2, apduCommand);
 
-    /* ISO7618 case determination and Le management */
-    if (dataIn.size() != 0) {
-        /* append Lc and ingoing data */
-        apduCommand[4] = static_cast<uint8_t>(dataIn.size());
-        System::arraycopy(dataIn, 0, apduCommand, 5, static_cast<int>(dataIn.size()));
-        /* Case3: ingoing data only, no Le */
-    } else {
-        /* Case1: no ingoing, no outgoing data, P3/Le = 0 */
-        apduCommand[4] = 0x00;
-    }
     return apduCommand;
 }
 
@@ -89,22 +78,13 @@ const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
                                            const uint8_t ins,
                                            const uint8_t p1,
                                            const uint8_t p2,
+                                           const uint8_t* dataIn,
+                                           const size_t dataInLength,
                                            const uint8_t le)
 {
     std::vector<uint8_t> apduCommand;
 
-    /* Buffer allocation */
-    apduCommand = allocateBuffer(le);
-
-    /* Build APDU buffer from provided arguments */
-    apduCommand[0] = cla;
-    apduCommand[1] = ins;
-    apduCommand[2] = p1;
-    apduCommand[3] = p2;
-
-    /* ISO7618 case determination and Le management */
-    /* Case2: outgoing data only */
-    apduCommand[4] = le;
+    write(cla, ins, p1, p2, dataIn, dataInLength, le, apduCommand);
 
     return apduCommand;
 }
@@ -112,75 +92,451 @@ const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
 const std::vector<uint8_t> ApduUtil::build(const uint8_t cla,
                                            const uint8_t ins,
                                            const uint8_t p1,
-                                           const uint8_t p2)
+                                           const uint8_t p2,
+                                           const uint8_t* dataIn,
+                                           const size_t dataInLength)
 {
     std::vector<uint8_t> apduCommand;
 
-    /* Buffer allocation */
-    apduCommand = allocateBuffer();
+    write(cla, ins, p1, p2, dataIn, dataInLength, apduCommand);
+
+    return apduCommand;
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t* dataIn,
+                       const size_t dataInLength,
+                       const uint8_t le,
+                       uint8_t* apduCommand)
+{
+    size_t length = writeHeaderAndData(cla, ins, p1, p2, dataIn, dataInLength, apduCommand);
+
+    /* Case 4, or case 2 without ingoing data */
+    apduCommand[length++] = le;
+
+    return length;
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t* dataIn,
+                       const size_t dataInLength,
+                       uint8_t* apduCommand)
+{
+    size_t length = writeHeaderAndData(cla, ins, p1, p2, dataIn, dataInLength, apduCommand);
+
+    if (dataInLength == 0) {
+        /* Case1: no ingoing, no outgoing data, P3/Le = 0 */
+        apduCommand[length++] = 0x00;
+    }
+
+    return length;
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t le,
+                       uint8_t* apduCommand)
+{
+    return write(cla, ins, p1, p2, nullptr, 0, le, apduCommand);
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       uint8_t* apduCommand)
+{
+    return write(cla, ins, p1, p2, nullptr, 0, apduCommand);
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t* dataIn,
+                       const size_t dataInLength,
+                       const uint8_t le,
+                       std::vector<uint8_t>& apduCommand)
+{
+    /* Header, Lc, data and Le */
+    apduCommand.resize(dataInLength + 6);
+    apduCommand.resize(write(cla, ins, p1, p2, dataIn, dataInLength, le, apduCommand.data()));
+
+    return apduCommand.size();
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t* dataIn,
+                       const size_t dataInLength,
+                       std::vector<uint8_t>& apduCommand)
+{
+    /* Header, Lc and data */
+    apduCommand.resize(dataInLength + 5);
+    apduCommand.resize(write(cla, ins, p1, p2, dataIn, dataInLength, apduCommand.data()));
+
+    return apduCommand.size();
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       const uint8_t le,
+                       std::vector<uint8_t>& apduCommand)
+{
+    return write(cla, ins, p1, p2, nullptr, 0, le, apduCommand);
+}
+
+size_t ApduUtil::write(const uint8_t cla,
+                       const uint8_t ins,
+                       const uint8_t p1,
+                       const uint8_t p2,
+                       std::vector<uint8_t>& apduCommand)
+{
+    return write(cla, ins, p1, p2, nullptr, 0, apduCommand);
+}
+
+const std::vector<uint8_t> ApduUtil::buildExtended(const uint8_t cla,
+                                                   const uint8_t ins,
+                                                   const uint8_t p1,
+                                                   const uint8_t p2,
+                                                   const std::vector<uint8_t>& dataIn,
+                                                   const uint16_t le)
+{
+    std::vector<uint8_t> apduCommand;
+
+    writeExtended(cla, ins, p1, p2, dataIn.data(), dataIn.size(), le, apduCommand);
+
+    return apduCommand;
+}
+
+const std::vector<uint8_t> ApduUtil::buildExtended(const uint8_t cla,
+                                                   const uint8_t ins,
+                                                   const uint8_t p1,
+                                                   const uint8_t p2,
+                                                   const std::vector<uint8_t>& dataIn)
+{
+    std::vector<uint8_t> apduCommand;
+
+    writeExtended(cla, ins, p1, p2, dataIn.data(), dataIn.size(), apduCommand);
+
+    return apduCommand;
+}
+
+const std::vector<uint8_t> ApduUtil::buildExtended(const uint8_t cla,
+                                                   const uint8_t ins,
+                                                   const uint8_t p1,
+                                                   const uint8_t p2,
+                                                   const uint16_t le)
+{
+    std::vector<uint8_t> apduCommand;
+
+    writeExtended(cla, ins, p1, p2, le, apduCommand);
+
+    return apduCommand;
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               const uint16_t le,
+                               uint8_t* apduCommand)
+{
+    size_t length =
+        writeExtendedHeaderAndData(cla, ins, p1, p2, dataIn, dataInLength, apduCommand);
+
+    /* Case 2E: the 00h marker is only present when there is no extended Lc */
+    if (dataInLength == 0) {
+        apduCommand[length++] = 0x00;
+    }
+
+    apduCommand[length++] = static_cast<uint8_t>(le >> 8);
+    apduCommand[length++] = static_cast<uint8_t>(le);
+
+    return length;
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               uint8_t* apduCommand)
+{
+    size_t length =
+        writeExtendedHeaderAndData(cla, ins, p1, p2, dataIn, dataInLength, apduCommand);
+
+    if (dataInLength == 0) {
+        /* Case1: no extended form, P3/Le = 0 */
+        apduCommand[length++] = 0x00;
+    }
+
+    return length;
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint16_t le,
+                               uint8_t* apduCommand)
+{
+    return writeExtended(cla, ins, p1, p2, nullptr, 0, le, apduCommand);
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               const uint16_t le,
+                               std::vector<uint8_t>& apduCommand)
+{
+    /* Header, 00h, Lc (2 bytes), data and Le (2 bytes) */
+    apduCommand.resize(dataInLength + 9);
+    apduCommand.resize(
+        writeExtended(cla, ins, p1, p2, dataIn, dataInLength, le, apduCommand.data()));
+
+    return apduCommand.size();
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               std::vector<uint8_t>& apduCommand)
+{
+    /* Header, 00h, Lc (2 bytes) and data */
+    apduCommand.resize(dataInLength + 7);
+    apduCommand.resize(writeExtended(cla, ins, p1, p2, dataIn, dataInLength, apduCommand.data()));
+
+    return apduCommand.size();
+}
+
+size_t ApduUtil::writeExtended(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint16_t le,
+                               std::vector<uint8_t>& apduCommand)
+{
+    return writeExtended(cla, ins, p1, p2, nullptr, 0, le, apduCommand);
+}
+
+size_t ApduUtil::writeHeaderAndData(const uint8_t cla,
+                                    const uint8_t ins,
+                                    const uint8_t p1,
+                                    const uint8_t p2,
+                                    const uint8_t* dataIn,
+                                    const size_t dataInLength,
+                                    uint8_t* apduCommand)
+{
+    if (dataInLength > MAX_SHORT_DATA_LENGTH) {
+        throw IllegalArgumentException("Data field too long for a short APDU.");
+    }
 
-    /* Build APDU buffer from provided arguments */
     apduCommand[0] = cla;
     apduCommand[1] = ins;
     apduCommand[2] = p1;
     apduCommand[3] = p2;
 
-    /* ISO7618 case determination and Le management */
-    /* Case1: no ingoing, no outgoing data, P3/Le = 0 */
-    apduCommand[4] = 0x00;
+    if (dataInLength == 0) {
+        return 4;
+    }
 
-    return apduCommand;
+    /* Lc and ingoing data */
+    apduCommand[4] = static_cast<uint8_t>(dataInLength);
+    std::memcpy(apduCommand + 5, dataIn, dataInLength);
+
+    return 5 + dataInLength;
 }
 
-std::vector<uint8_t> ApduUtil::allocateBuffer(const std::vector<uint8_t>& data, const uint8_t le)
+size_t ApduUtil::writeExtendedHeaderAndData(const uint8_t cla,
+                                            const uint8_t ins,
+                                            const uint8_t p1,
+                                            const uint8_t p2,
+                                            const uint8_t* dataIn,
+                                            const size_t dataInLength,
+                                            uint8_t* apduCommand)
 {
-    (void)le;
+    if (dataInLength > MAX_EXTENDED_DATA_LENGTH) {
+        throw IllegalArgumentException("Data field too long for an extended APDU.");
+    }
+
+    apduCommand[0] = cla;
+    apduCommand[1] = ins;
+    apduCommand[2] = p1;
+    apduCommand[3] = p2;
 
-    int length = 4;                              // Header
+    if (dataInLength == 0) {
+        return 4;
+    }
 
-    length += static_cast<int>(data.size() + 1); // Lc + data
-    length += 1;                                 // Le
+    /* Extended Lc (00h followed by 2 bytes) and ingoing data */
+    apduCommand[4] = 0x00;
+    apduCommand[5] = static_cast<uint8_t>(dataInLength >> 8);
+    apduCommand[6] = static_cast<uint8_t>(dataInLength);
+    std::memcpy(apduCommand + 7, dataIn, dataInLength);
 
-    return std::vector<uint8_t>(length);
+    return 7 + dataInLength;
 }
 
-std::vector<uint8_t> ApduUtil::allocateBuffer(const std::vector<uint8_t>& data)
+size_t ApduUtil::writeChained(const uint8_t cla,
+                              const uint8_t ins,
+                              const uint8_t p1,
+                              const uint8_t p2,
+                              const uint8_t* dataIn,
+                              const size_t dataInLength,
+                              const uint8_t le,
+                              const size_t maxDataLength,
+                              std::vector<uint8_t>& apduCommands,
+                              std::vector<size_t>& offsets)
 {
-    int length = 4;                              // Header
-
-    length += static_cast<int>(data.size() + 1); // Lc + data
+    return writeChained(
+        cla, ins, p1, p2, dataIn, dataInLength, true, le, maxDataLength, apduCommands, offsets);
+}
 
-    return std::vector<uint8_t>(length);
+size_t ApduUtil::writeChained(const uint8_t cla,
+                              const uint8_t ins,
+                              const uint8_t p1,
+                              const uint8_t p2,
+                              const uint8_t* dataIn,
+                              const size_t dataInLength,
+                              const size_t maxDataLength,
+                              std::vector<uint8_t>& apduCommands,
+                              std::vector<size_t>& offsets)
+{
+    return writeChained(
+        cla, ins, p1, p2, dataIn, dataInLength, false, 0, maxDataLength, apduCommands, offsets);
 }
 
-std::vector<uint8_t> ApduUtil::allocateBuffer(const uint8_t le)
+size_t ApduUtil::writeChained(const uint8_t cla,
+                              const uint8_t ins,
+                              const uint8_t p1,
+                              const uint8_t p2,
+                              const uint8_t* dataIn,
+                              const size_t dataInLength,
+                              const bool hasLe,
+                              const uint8_t le,
+                              const size_t maxDataLength,
+                              std::vector<uint8_t>& apduCommands,
+                              std::vector<size_t>& offsets)
 {
-    (void)le;
+    if (maxDataLength == 0 || maxDataLength > MAX_SHORT_DATA_LENGTH) {
+        throw IllegalArgumentException("Invalid maximum data length: " +
+                                       std::to_string(maxDataLength));
+    }
 
-    int length = 4;            // Header
+    const size_t count =
+        dataInLength == 0 ? 1 : (dataInLength + maxDataLength - 1) / maxDataLength;
+
+    /* Headers and Lc of all the commands, plus Le or P3 of the last one */
+    apduCommands.resize(dataInLength + 5 * count + 1);
+    offsets.resize(count + 1);
+
+    uint8_t* const buffer = apduCommands.data();
+    size_t length = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        const size_t offset = i * maxDataLength;
+        offsets[i] = length;
+
+        if (i < count - 1) {
+            length += write(static_cast<uint8_t>(cla | CLA_CHAINING_BIT),
+                            ins,
+                            p1,
+                            p2,
+                            dataIn + offset,
+                            maxDataLength,
+                            buffer + length);
+        } else if (hasLe) {
+            length += write(
+                cla, ins, p1, p2, dataIn + offset, dataInLength - offset, le, buffer + length);
+        } else {
+            length +=
+                write(cla, ins, p1, p2, dataIn + offset, dataInLength - offset, buffer + length);
+        }
+    }
 
-    length += 1;               // Le
+    offsets[count] = length;
+    apduCommands.resize(length);
 
-    return std::vector<uint8_t>(length);
+    return count;
 }
 
-std::vector<uint8_t> ApduUtil::allocateBuffer()
+ApduUtil::ApduCase ApduUtil::getCase(const std::vector<uint8_t>& apduCommand)
 {
-    int length = 4;            // Header
+    const size_t length = apduCommand.size();
+
+    if (length < 4) {
+        return ApduCase::INVALID;
+    }
+
+    if (length == 4) {
+        return ApduCase::CASE_1;
+    }
+
+    if (length == 5) {
+        return ApduCase::CASE_2;
+    }
+
+    /* Short Lc */
+    if (apduCommand[4] != 0) {
+        const size_t lc = apduCommand[4];
+
+        if (length == 5 + lc) {
+            return ApduCase::CASE_3;
+        }
+
+        return length == 6 + lc ? ApduCase::CASE_4 : ApduCase::INVALID;
+    }
+
+    /* 00h marker followed by an extended Le (2E) or an extended Lc (3E, 4E) */
+    if (length == 7) {
+        return ApduCase::CASE_2E;
+    }
+
+    /* Extended Lc incomplete */
+    if (length < 7) {
+        return ApduCase::INVALID;
+    }
 
-    /* Case 1: 5-byte apdu, le=0 */
-    length += 1;               // Le
+    const size_t lc = static_cast<size_t>((apduCommand[5] << 8) | apduCommand[6]);
 
-    return std::vector<uint8_t>(length);
+    if (lc == 0) {
+        return ApduCase::INVALID;
+    }
+
+    if (length == 7 + lc) {
+        return ApduCase::CASE_3E;
+    }
+
+    return length == 9 + lc ? ApduCase::CASE_4E : ApduCase::INVALID;
 }
 
 bool ApduUtil::isCase4(const std::vector<uint8_t>& apduCommand)
 {
-    if (apduCommand.size() > 4) {
-        return apduCommand[4] == apduCommand.size() - 6;
-    }
+    const ApduCase apduCase = getCase(apduCommand);
 
-    return false;
+    return apduCase == ApduCase::CASE_4 || apduCase == ApduCase::CASE_4E;
 }
 
 }
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <vector>
 
@@ -29,6 +30,74 @@ namespace util {
  */
 class KEYPLEUTIL_API ApduUtil final {
 public:
+    /**
+     * ISO 7816-4 case of an APDU command.
+     *
+     * @since 2.4.0
+     */
+    enum class ApduCase {
+        /**
+         * Not a well formed APDU command.
+         */
+        INVALID,
+
+        /**
+         * No command data, no response data expected.
+         */
+        CASE_1,
+
+        /**
+         * No command data, short Le.
+         */
+        CASE_2,
+
+        /**
+         * Short Lc and command data, no response data expected.
+         */
+        CASE_3,
+
+        /**
+         * Short Lc, command data and short Le.
+         */
+        CASE_4,
+
+        /**
+         * No command data, extended Le.
+         */
+        CASE_2E,
+
+        /**
+         * Extended Lc and command data, no response data expected.
+         */
+        CASE_3E,
+
+        /**
+         * Extended Lc, command data and extended Le.
+         */
+        CASE_4E
+    };
+
+    /**
+     * Maximum length of the data field of a short APDU command.
+     *
+     * @since 2.4.0
+     */
+    static const size_t MAX_SHORT_DATA_LENGTH = 255;
+
+    /**
+     * Maximum length of the data field of an extended APDU command.
+     *
+     * @since 2.4.0
+     */
+    static const size_t MAX_EXTENDED_DATA_LENGTH = 65535;
+
+    /**
+     * Bit of CLA indicating that the command is not the last one of a chain.
+     *
+     * @since 2.4.0
+     */
+    static const uint8_t CLA_CHAINING_BIT = 0x10;
+
     /**
      * Builds an APDU request from its elements as defined by the ISO 7816 standard.
      *
@@ -36,10 +105,11 @@ public:
      * @param ins The instruction byte.
      * @param p1 The parameter 1.
      * @param p2 The parameter 2.
-     * @param dataIn The data field of the command (optional). If empty, then LC will be set to 0.
+     * @param dataIn The data field of the command (optional). If empty, then the APDU is case 2.
      * @param le The maximum number of bytes expected in the data field of the response to the
      *           command (optional).
      * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataIn is longer than 255 bytes.
      * @since 2.0.0
      */
     static const std::vector<uint8_t> build(const uint8_t cla,
@@ -58,6 +128,7 @@ public:
      * @param p2 The parameter 2.
      * @param dataIn The data field of the command (optional).
      * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataIn is longer than 255 bytes.
      * @since 2.0.0
      */
     static const std::vector<uint8_t> build(const uint8_t cla,
@@ -100,40 +171,490 @@ public:
                                             const uint8_t p2);
 
     /**
-     * (private)<br>
-     * Returns a byte array having the expected length according the APDU construction rules.
+     * Builds an APDU request from its elements as defined by the ISO 7816 standard.
      *
-     * @param data Data array
-     * @param le Expected outgoing length
-     * @return A new byte array.
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field. If 0, then the APDU is case 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
      */
-    static std::vector<uint8_t> allocateBuffer(const std::vector<uint8_t>& data, const uint8_t le);
+    static const std::vector<uint8_t> build(const uint8_t cla,
+                                            const uint8_t ins,
+                                            const uint8_t p1,
+                                            const uint8_t p2,
+                                            const uint8_t* dataIn,
+                                            const size_t dataInLength,
+                                            const uint8_t le);
 
     /**
-     * (private)<br>
-     * Returns a byte array having the expected length according the APDU construction rules.
+     * Builds an APDU request from its elements as defined by the ISO 7816 standard.
      *
-     * @param data Data array
-     * @return A new byte array.
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field. If 0, then the APDU is case 1.
+     * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
      */
-    static std::vector<uint8_t> allocateBuffer(const std::vector<uint8_t>& data);
+    static const std::vector<uint8_t> build(const uint8_t cla,
+                                            const uint8_t ins,
+                                            const uint8_t p1,
+                                            const uint8_t p2,
+                                            const uint8_t* dataIn,
+                                            const size_t dataInLength);
 
     /**
-     * (private)<br>
-     * Returns a byte array having the expected length according the APDU construction rules.
+     * Writes an APDU request (case 4, or case 2 without data) into the provided buffer.
      *
-     * @param le Expected outgoing length
-     * @return A new byte array.
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @param apduCommand The destination, at least dataInLength + 6 bytes long.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
      */
-    static std::vector<uint8_t> allocateBuffer(const uint8_t le);
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t* dataIn,
+                        const size_t dataInLength,
+                        const uint8_t le,
+                        uint8_t* apduCommand);
 
     /**
-     * (private)<br>
-     * Returns a byte array having the expected length according the APDU construction rules.
+     * Writes an APDU request (case 3, or case 1 without data) into the provided buffer.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param apduCommand The destination, at least dataInLength + 5 bytes long.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t* dataIn,
+                        const size_t dataInLength,
+                        uint8_t* apduCommand);
+
+    /**
+     * Writes an APDU request (case 2) into the provided buffer.
      *
-     * @return A new byte array.
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @param apduCommand The destination, at least 5 bytes long.
+     * @return The number of bytes written.
+     * @since 2.4.0
      */
-    static std::vector<uint8_t> allocateBuffer();
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t le,
+                        uint8_t* apduCommand);
+
+    /**
+     * Writes an APDU request (case 1) into the provided buffer.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param apduCommand The destination, at least 5 bytes long.
+     * @return The number of bytes written.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        uint8_t* apduCommand);
+
+    /**
+     * Writes an APDU request (case 4, or case 2 without data) into a reusable vector, resized to
+     * the APDU length (no reallocation once its capacity is large enough).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t* dataIn,
+                        const size_t dataInLength,
+                        const uint8_t le,
+                        std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Writes an APDU request (case 3, or case 1 without data) into a reusable vector, resized to
+     * the APDU length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t* dataIn,
+                        const size_t dataInLength,
+                        std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Writes an APDU request (case 2) into a reusable vector, resized to the APDU length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        const uint8_t le,
+                        std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Writes an APDU request (case 1) into a reusable vector, resized to the APDU length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @since 2.4.0
+     */
+    static size_t write(const uint8_t cla,
+                        const uint8_t ins,
+                        const uint8_t p1,
+                        const uint8_t p2,
+                        std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Builds an extended length APDU request (case 4E, or case 2E without data).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command (up to 65535 bytes).
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataIn is longer than 65535 bytes.
+     * @since 2.4.0
+     */
+    static const std::vector<uint8_t> buildExtended(const uint8_t cla,
+                                                    const uint8_t ins,
+                                                    const uint8_t p1,
+                                                    const uint8_t p2,
+                                                    const std::vector<uint8_t>& dataIn,
+                                                    const uint16_t le);
+
+    /**
+     * Builds an extended length APDU request (case 3E, or case 1 without data).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command (up to 65535 bytes).
+     * @return A byte array containing the resulting apdu command data.
+     * @throw IllegalArgumentException If dataIn is longer than 65535 bytes.
+     * @since 2.4.0
+     */
+    static const std::vector<uint8_t> buildExtended(const uint8_t cla,
+                                                    const uint8_t ins,
+                                                    const uint8_t p1,
+                                                    const uint8_t p2,
+                                                    const std::vector<uint8_t>& dataIn);
+
+    /**
+     * Builds an extended length APDU request (case 2E).
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @return A byte array containing the resulting apdu command data.
+     * @since 2.4.0
+     */
+    static const std::vector<uint8_t> buildExtended(const uint8_t cla,
+                                                    const uint8_t ins,
+                                                    const uint8_t p1,
+                                                    const uint8_t p2,
+                                                    const uint16_t le);
+
+    /**
+     * Writes an extended length APDU request (case 4E, or case 2E without data) into the provided
+     * buffer.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @param apduCommand The destination, at least dataInLength + 9 bytes long.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 65535.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint8_t* dataIn,
+                                const size_t dataInLength,
+                                const uint16_t le,
+                                uint8_t* apduCommand);
+
+    /**
+     * Writes an extended length APDU request (case 3E, or case 1 without data) into the provided
+     * buffer.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param apduCommand The destination, at least dataInLength + 7 bytes long.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 65535.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint8_t* dataIn,
+                                const size_t dataInLength,
+                                uint8_t* apduCommand);
+
+    /**
+     * Writes an extended length APDU request (case 2E) into the provided buffer.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @param apduCommand The destination, at least 7 bytes long.
+     * @return The number of bytes written.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint16_t le,
+                                uint8_t* apduCommand);
+
+    /**
+     * Writes an extended length APDU request (case 4E, or case 2E without data) into a reusable
+     * vector, resized to the APDU length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 65535.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint8_t* dataIn,
+                                const size_t dataInLength,
+                                const uint16_t le,
+                                std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Writes an extended length APDU request (case 3E, or case 1 without data) into a reusable
+     * vector, resized to the APDU length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field of the command.
+     * @param dataInLength The length of the data field.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 65535.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint8_t* dataIn,
+                                const size_t dataInLength,
+                                std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Writes an extended length APDU request (case 2E) into a reusable vector, resized to the APDU
+     * length.
+     *
+     * @param cla The class byte.
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param le The maximum number of bytes expected in the data field of the response to the
+     *           command, 0 standing for 65536.
+     * @param apduCommand The destination.
+     * @return The number of bytes written.
+     * @since 2.4.0
+     */
+    static size_t writeExtended(const uint8_t cla,
+                                const uint8_t ins,
+                                const uint8_t p1,
+                                const uint8_t p2,
+                                const uint16_t le,
+                                std::vector<uint8_t>& apduCommand);
+
+    /**
+     * Splits a command whose data field exceeds the card capacity into a chain of commands (ISO
+     * 7816-4 command chaining), written one after the other into a single buffer.
+     *
+     * <p>All the commands but the last one have the chaining bit (b5) of CLA set and no Le. The
+     * last one carries Le (case 4, or case 2 without data).
+     *
+     * @param cla The class byte (chaining bit cleared).
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field to split.
+     * @param dataInLength The length of the data field.
+     * @param le The maximum number of bytes expected in the data field of the response to the last
+     *           command.
+     * @param maxDataLength The maximum length of the data field of each command (1 to 255).
+     * @param apduCommands The destination, replaced by the commands of the chain.
+     * @param offsets Replaced by the offsets of the commands in apduCommands, followed by the
+     *        total length (command i spans offsets[i] to offsets[i + 1]).
+     * @return The number of commands.
+     * @throw IllegalArgumentException If maxDataLength is out of range.
+     * @since 2.4.0
+     */
+    static size_t writeChained(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               const uint8_t le,
+                               const size_t maxDataLength,
+                               std::vector<uint8_t>& apduCommands,
+                               std::vector<size_t>& offsets);
+
+    /**
+     * Splits a command whose data field exceeds the card capacity into a chain of commands (ISO
+     * 7816-4 command chaining), written one after the other into a single buffer.
+     *
+     * <p>All the commands but the last one have the chaining bit (b5) of CLA set. None of them
+     * carries Le (case 3, or case 1 without data).
+     *
+     * @param cla The class byte (chaining bit cleared).
+     * @param ins The instruction byte.
+     * @param p1 The parameter 1.
+     * @param p2 The parameter 2.
+     * @param dataIn The data field to split.
+     * @param dataInLength The length of the data field.
+     * @param maxDataLength The maximum length of the data field of each command (1 to 255).
+     * @param apduCommands The destination, replaced by the commands of the chain.
+     * @param offsets Replaced by the offsets of the commands in apduCommands, followed by the
+     *        total length (command i spans offsets[i] to offsets[i + 1]).
+     * @return The number of commands.
+     * @throw IllegalArgumentException If maxDataLength is out of range.
+     * @since 2.4.0
+     */
+    static size_t writeChained(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               const size_t maxDataLength,
+                               std::vector<uint8_t>& apduCommands,
+                               std::vector<size_t>& offsets);
+
+    /**
+     * Determines the ISO 7816-4 case of an APDU command from its length and its Lc field.
+     *
+     * <p>A 5 bytes command is reported as case 2, including the case 1 commands built by this
+     * class (P3 set to 0), which can't be told from a case 2 command expecting 256 bytes.
+     *
+     * @param apduCommand The APDU command.
+     * @return {@link ApduCase#INVALID} if the length of the command doesn't match its Lc field.
+     * @since 2.4.0
+     */
+    static ApduCase getCase(const std::vector<uint8_t>& apduCommand);
 
     /**
      * Indicates if the provided byte array contains a case4 APDU command.
@@ -156,6 +677,9 @@ public:
      * In this case (incoming and outgoing data for the card), Le is set to 0, letting the lower
      * layer (see API plugin) take care of recovering the exact length of the outgoing data.
      *
+     * <p>Both short (case 4) and extended (case 4E) commands are recognized, see {@link
+     * #getCase(const std::vector<uint8_t>&)}.
+     *
      * @param apduCommand The apduCommand to check.
      * @return true the APDU command is case 4.
      * @since 2.0.0
@@ -168,6 +692,55 @@ private:
      * Constructor
      */
     ApduUtil();
+
+    /**
+     * (private)<br>
+     * Writes the header, then Lc and the data field if there is data.
+     *
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 255.
+     */
+    static size_t writeHeaderAndData(const uint8_t cla,
+                                     const uint8_t ins,
+                                     const uint8_t p1,
+                                     const uint8_t p2,
+                                     const uint8_t* dataIn,
+                                     const size_t dataInLength,
+                                     uint8_t* apduCommand);
+
+    /**
+     * (private)<br>
+     * Writes the header, then the extended Lc and the data field if there is data.
+     *
+     * @return The number of bytes written.
+     * @throw IllegalArgumentException If dataInLength is greater than 65535.
+     */
+    static size_t writeExtendedHeaderAndData(const uint8_t cla,
+                                             const uint8_t ins,
+                                             const uint8_t p1,
+                                             const uint8_t p2,
+                                             const uint8_t* dataIn,
+                                             const size_t dataInLength,
+                                             uint8_t* apduCommand);
+
+    /**
+     * (private)<br>
+     * Writes the chain of commands, the last one carrying Le if hasLe is true.
+     *
+     * @return The number of commands.
+     * @throw IllegalArgumentException If maxDataLength is out of range.
+     */
+    static size_t writeChained(const uint8_t cla,
+                               const uint8_t ins,
+                               const uint8_t p1,
+                               const uint8_t p2,
+                               const uint8_t* dataIn,
+                               const size_t dataInLength,
+                               const bool hasLe,
+                               const uint8_t le,
+                               const size_t maxDataLength,
+                               std::vector<uint8_t>& apduCommands,
+                               std::vector<size_t>& offsets);
 };
 
 }
@@ -0,0 +1,163 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BerTlvIndex.h"
+
+#include <algorithm>
+
+namespace keyple {
+namespace core {
+namespace util {
+
+BerTlvIndex::BerTlvIndex(const uint8_t* data, const size_t length)
+: mData(data), mTlvs(BerTlvReader::readAll(data, length, false))
+{
+    build();
+}
+
+BerTlvIndex::BerTlvIndex(const std::vector<uint8_t>& tlvStructure)
+: BerTlvIndex(tlvStructure.data(), tlvStructure.size()) {}
+
+void BerTlvIndex::build()
+{
+    const int size = static_cast<int>(mTlvs.size());
+    int path[BerTlvReader::MAX_DEPTH];
+
+    mParents.resize(size);
+    mSubtreeEnds.resize(size);
+
+    /* The constructed TLVs enclosing the current one, indexed by depth */
+    for (int i = 0; i < size; i++) {
+        const int depth = mTlvs[i].depth;
+
+        mParents[i] = depth > 0 ? path[depth - 1] : -1;
+        path[depth] = i;
+
+        /* Closes the subtrees of the previous TLVs that are not ancestors of this one */
+        for (int j = i - 1; j >= 0 && mTlvs[j].depth >= depth; j = mParents[j]) {
+            mSubtreeEnds[j] = i;
+            if (mTlvs[j].depth == depth) {
+                break;
+            }
+        }
+    }
+
+    for (int i = 0; i < size; i++) {
+        if (mSubtreeEnds[i] == 0) {
+            mSubtreeEnds[i] = size;
+        }
+    }
+
+    /* Tags sorted once for binary search, document order kept among identical tags */
+    mSortedIndexes.resize(size);
+    for (int i = 0; i < size; i++) {
+        mSortedIndexes[i] = i;
+    }
+
+    const std::vector<BerTlvReader::Tlv>& tlvs = mTlvs;
+    std::sort(mSortedIndexes.begin(), mSortedIndexes.end(), [&tlvs](const int a, const int b) {
+        return tlvs[a].tag < tlvs[b].tag || (tlvs[a].tag == tlvs[b].tag && a < b);
+    });
+
+    mSortedTags.resize(size);
+    for (int i = 0; i < size; i++) {
+        mSortedTags[i] = mTlvs[mSortedIndexes[i]].tag;
+    }
+}
+
+size_t BerTlvIndex::size() const
+{
+    return mTlvs.size();
+}
+
+const BerTlvReader::Tlv& BerTlvIndex::getTlv(const int index) const
+{
+    return mTlvs[index];
+}
+
+const uint8_t* BerTlvIndex::getValue(const int index) const
+{
+    return mData + mTlvs[index].valueOffset;
+}
+
+int BerTlvIndex::getParent(const int index) const
+{
+    return mParents[index];
+}
+
+size_t BerTlvIndex::count(const int tag) const
+{
+    const auto range = std::equal_range(mSortedTags.begin(), mSortedTags.end(), tag);
+
+    return static_cast<size_t>(range.second - range.first);
+}
+
+int BerTlvIndex::indexOf(const int tag, const size_t occurrence) const
+{
+    const auto it = std::lower_bound(mSortedTags.begin(), mSortedTags.end(), tag);
+    const size_t position = static_cast<size_t>(it - mSortedTags.begin()) + occurrence;
+
+    if (position >= mSortedTags.size() || mSortedTags[position] != tag) {
+        return -1;
+    }
+
+    return mSortedIndexes[position];
+}
+
+int BerTlvIndex::indexOfChild(const int parent, const int tag) const
+{
+    const int size = static_cast<int>(mTlvs.size());
+    const int end = parent >= 0 ? mSubtreeEnds[parent] : size;
+
+    /* Jumps from sibling to sibling */
+    for (int i = parent + 1; i < end; i = mSubtreeEnds[i]) {
+        if (mTlvs[i].tag == tag) {
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+const std::map<const int, std::vector<std::vector<uint8_t>>> BerTlvIndex::toMap(
+    const bool primitiveOnly) const
+{
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    for (const auto& tlv : mTlvs) {
+        if (!primitiveOnly || !tlv.constructed) {
+            const uint8_t* value = mData + tlv.valueOffset;
+            tlvs[tlv.tag].emplace_back(value, value + tlv.valueLength);
+        }
+    }
+
+    return tlvs;
+}
+
+const std::map<const int, const std::vector<uint8_t>> BerTlvIndex::toSimpleMap(
+    const bool primitiveOnly) const
+{
+    std::map<const int, const std::vector<uint8_t>> tlvs;
+
+    for (const auto& tlv : mTlvs) {
+        if ((!primitiveOnly || !tlv.constructed) && tlvs.find(tlv.tag) == tlvs.end()) {
+            const uint8_t* value = mData + tlv.valueOffset;
+            tlvs.insert({tlv.tag, std::vector<uint8_t>(value, value + tlv.valueLength)});
+        }
+    }
+
+    return tlvs;
+}
+
+}
+}
+}
@@ -0,0 +1,188 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+/* Keyple Core Util */
+#include "BerTlvReader.h"
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Flat index of the TLVs of a BER-TLV structure.
+ *
+ * <p>This is an alternative to the maps produced by {@link BerTlvUtil#parse(const
+ * std::vector<uint8_t>&, const bool)}: the TLVs are stored in a few contiguous arrays (document
+ * order, plus the tags sorted for binary search) and their values are not copied but located in
+ * the indexed buffer, which must therefore outlive the index.
+ *
+ * <p>TLVs are identified by their position in document order. The parent/child relationships are
+ * kept, so that the same tag can be looked up under a given constructed TLV.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BerTlvIndex final {
+public:
+    /**
+     * Indexes the provided TLV structure.
+     *
+     * @param data The TLV structure, must outlive the index.
+     * @param length The length of the structure.
+     * @throw IllegalArgumentException If the structure is invalid.
+     * @since 2.4.0
+     */
+    BerTlvIndex(const uint8_t* data, const size_t length);
+
+    /**
+     * Indexes the provided TLV structure.
+     *
+     * @param tlvStructure The TLV structure, must outlive the index.
+     * @throw IllegalArgumentException If the structure is invalid.
+     * @since 2.4.0
+     */
+    explicit BerTlvIndex(const std::vector<uint8_t>& tlvStructure);
+
+    /**
+     * Gets the number of TLVs (constructed and primitive).
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    size_t size() const;
+
+    /**
+     * Gets a TLV.
+     *
+     * @param index The position of the TLV in document order.
+     * @return A not null reference.
+     * @since 2.4.0
+     */
+    const BerTlvReader::Tlv& getTlv(const int index) const;
+
+    /**
+     * Gets a pointer to the value of a TLV.
+     *
+     * @param index The position of the TLV in document order.
+     * @return A pointer into the indexed buffer.
+     * @since 2.4.0
+     */
+    const uint8_t* getValue(const int index) const;
+
+    /**
+     * Gets the parent of a TLV.
+     *
+     * @param index The position of the TLV in document order.
+     * @return The position of the enclosing constructed TLV, -1 for a top level TLV.
+     * @since 2.4.0
+     */
+    int getParent(const int index) const;
+
+    /**
+     * Counts the occurrences of a tag.
+     *
+     * @param tag The tag ID (e.g. 0x84).
+     * @return 0 if the tag is absent.
+     * @since 2.4.0
+     */
+    size_t count(const int tag) const;
+
+    /**
+     * Finds an occurrence of a tag (binary search).
+     *
+     * @param tag The tag ID (e.g. 0x84).
+     * @param occurrence The rank of the occurrence in document order (0 for the first one).
+     * @return The position of the TLV in document order, -1 if not found.
+     * @since 2.4.0
+     */
+    int indexOf(const int tag, const size_t occurrence = 0) const;
+
+    /**
+     * Finds the first occurrence of a tag among the direct children of a constructed TLV.
+     *
+     * @param parent The position of the constructed TLV, -1 to search the top level TLVs.
+     * @param tag The tag ID (e.g. 0x84).
+     * @return The position of the TLV in document order, -1 if not found.
+     * @since 2.4.0
+     */
+    int indexOfChild(const int parent, const int tag) const;
+
+    /**
+     * Converts the index to the map produced by {@link BerTlvUtil#parse(const
+     * std::vector<uint8_t>&, const bool)}.
+     *
+     * @param primitiveOnly True if only primitives tags are to be placed in the map.
+     * @return A not null map.
+     * @since 2.4.0
+     */
+    const std::map<const int, std::vector<std::vector<uint8_t>>> toMap(
+        const bool primitiveOnly) const;
+
+    /**
+     * Converts the index to the map produced by {@link BerTlvUtil#parseSimple(const
+     * std::vector<uint8_t>&, const bool)} (first occurrence of each tag).
+     *
+     * @param primitiveOnly True if only primitives tags are to be placed in the map.
+     * @return A not null map.
+     * @since 2.4.0
+     */
+    const std::map<const int, const std::vector<uint8_t>> toSimpleMap(
+        const bool primitiveOnly) const;
+
+private:
+    /**
+     *
+     */
+    const uint8_t* mData;
+
+    /**
+     * TLVs in document order
+     */
+    std::vector<BerTlvReader::Tlv> mTlvs;
+
+    /**
+     * Position of the parent of each TLV (-1 at top level)
+     */
+    std::vector<int> mParents;
+
+    /**
+     * Position of the first TLV following each TLV and its descendants
+     */
+    std::vector<int> mSubtreeEnds;
+
+    /**
+     * Tag IDs in ascending order (document order for a given tag)
+     */
+    std::vector<int> mSortedTags;
+
+    /**
+     * Position of the TLV associated with each entry of mSortedTags
+     */
+    std::vector<int> mSortedIndexes;
+
+    /**
+     * (private)<br>
+     * Computes the relationships and the sorted tags from the TLVs.
+     */
+    void build();
+};
+
+}
+}
+}
@@ -0,0 +1,89 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BerTlvPath.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+BerTlvPath::BerTlvPath(const std::string& path)
+{
+    size_t start = 0;
+
+    for (;;) {
+        size_t end = path.find('/', start);
+        if (end == std::string::npos) {
+            end = path.length();
+        }
+
+        const size_t length = end - start;
+
+        if (length == 0 || length % 2 != 0 || length > 2 * BerTlvReader::MAX_TAG_SIZE ||
+            !HexUtil::isValid(path.data() + start, length)) {
+            throw IllegalArgumentException("Invalid tag ID in TLV path: " + path);
+        }
+
+        mTags.push_back(static_cast<int>(HexUtil::toInt(path.data() + start, length)));
+
+        if (end == path.length()) {
+            break;
+        }
+
+        start = end + 1;
+    }
+
+    if (mTags.size() > static_cast<size_t>(BerTlvReader::MAX_DEPTH)) {
+        throw IllegalArgumentException("TLV path too deep: " + path);
+    }
+}
+
+bool BerTlvPath::find(const uint8_t* data, const size_t length, BerTlvReader::Tlv& tlv) const
+{
+    const int last = static_cast<int>(mTags.size()) - 1;
+    BerTlvReader reader(data, length);
+
+    /*
+     * Only the TLVs whose ancestors match the path are read, so the depth of a TLV is also the
+     * index of the tag it must match. A mismatching subtree is skipped, and so is a matching one
+     * once it has been searched, the search then going on with the next siblings.
+     */
+    while (reader.next(tlv)) {
+        if (tlv.tag != mTags[tlv.depth]) {
+            reader.skip(tlv);
+        } else if (tlv.depth == last) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool BerTlvPath::find(const std::vector<uint8_t>& tlvStructure, BerTlvReader::Tlv& tlv) const
+{
+    return find(tlvStructure.data(), tlvStructure.size(), tlv);
+}
+
+const std::vector<int>& BerTlvPath::getTags() const
+{
+    return mTags;
+}
+
+}
+}
+}
@@ -0,0 +1,92 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* Keyple Core Util */
+#include "BerTlvReader.h"
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Path to a TLV in a BER-TLV structure, compiled once and evaluated against many structures.
+ *
+ * <p>The path is made of the hexadecimal tag IDs leading to the TLV, separated by slashes (e.g.
+ * "6F/A5/BF0C/61/4F" for the AID of an application in a PPSE selection response).
+ *
+ * <p>The evaluation walks only the TLVs whose ancestors match the beginning of the path, the
+ * other ones being skipped by their length. It allocates no memory.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BerTlvPath final {
+public:
+    /**
+     * Compiles a path.
+     *
+     * @param path The tag IDs separated by slashes.
+     * @throw IllegalArgumentException If the path is empty, too deep or contains an invalid tag ID.
+     * @since 2.4.0
+     */
+    explicit BerTlvPath(const std::string& path);
+
+    /**
+     * Finds the first TLV matching the path.
+     *
+     * <p>Only the part of the structure walked is validated.
+     *
+     * @param data The TLV structure.
+     * @param length The length of the structure.
+     * @param tlv The TLV to fill if found, its value starting at data + tlv.valueOffset.
+     * @return False if no TLV matches the path.
+     * @throw IllegalArgumentException If the walked part of the structure is invalid.
+     * @since 2.4.0
+     */
+    bool find(const uint8_t* data, const size_t length, BerTlvReader::Tlv& tlv) const;
+
+    /**
+     * Finds the first TLV matching the path.
+     *
+     * @param tlvStructure The TLV structure.
+     * @param tlv The TLV to fill if found.
+     * @return False if no TLV matches the path.
+     * @throw IllegalArgumentException If the walked part of the structure is invalid.
+     * @since 2.4.0
+     */
+    bool find(const std::vector<uint8_t>& tlvStructure, BerTlvReader::Tlv& tlv) const;
+
+    /**
+     * Gets the tag IDs of the path.
+     *
+     * @return A not empty list, from the top level TLV to the searched one.
+     * @since 2.4.0
+     */
+    const std::vector<int>& getTags() const;
+
+private:
+    /**
+     * Tag IDs, indexed by depth
+     */
+    std::vector<int> mTags;
+};
+
+}
+}
+}
@@ -0,0 +1,213 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BerTlvReader.h"
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+const int BerTlvReader::MAX_DEPTH;
+const size_t BerTlvReader::MAX_TAG_SIZE;
+const size_t BerTlvReader::MAX_LENGTH_SIZE;
+
+BerTlvReader::BerTlvReader(const uint8_t* data, const size_t length)
+: mData(data), mLength(length), mOffset(0), mDepth(0) {}
+
+BerTlvReader::BerTlvReader(const std::vector<uint8_t>& tlvStructure)
+: BerTlvReader(tlvStructure.data(), tlvStructure.size()) {}
+
+bool BerTlvReader::next(Tlv& tlv)
+{
+    Error error;
+
+    if (next(tlv, error)) {
+        return true;
+    }
+
+    switch (error) {
+    case Error::NONE:
+        return false;
+    case Error::TOO_DEEP:
+        throw IllegalArgumentException("TLV structure too deep.");
+    default:
+        throw IllegalArgumentException("Invalid TLV structure.");
+    }
+}
+
+bool BerTlvReader::next(Tlv& tlv, Error& error)
+{
+    /* Leaves the constructed TLVs whose value has been fully read */
+    while (mDepth > 0 && mOffset == mEnds[mDepth - 1]) {
+        mDepth--;
+    }
+
+    if (mOffset >= mLength) {
+        error = Error::NONE;
+        return false;
+    }
+
+    const size_t end = mDepth > 0 ? mEnds[mDepth - 1] : mLength;
+
+    error = decodeHeader(mData, end, mOffset, tlv);
+    if (error != Error::NONE) {
+        return false;
+    }
+
+    tlv.depth = mDepth;
+
+    if (tlv.constructed) {
+        if (mDepth == MAX_DEPTH) {
+            error = Error::TOO_DEEP;
+            return false;
+        }
+
+        /* Walks into the value */
+        mEnds[mDepth++] = tlv.valueOffset + tlv.valueLength;
+        mOffset = tlv.valueOffset;
+    } else {
+        mOffset = tlv.valueOffset + tlv.valueLength;
+    }
+
+    return true;
+}
+
+void BerTlvReader::skip(const Tlv& tlv)
+{
+    if (tlv.constructed) {
+        mDepth--;
+        mOffset = mEnds[mDepth];
+    }
+}
+
+size_t BerTlvReader::getOffset() const
+{
+    return mOffset;
+}
+
+const uint8_t* BerTlvReader::getValue(const Tlv& tlv) const
+{
+    return mData + tlv.valueOffset;
+}
+
+std::vector<BerTlvReader::Tlv> BerTlvReader::readAll(const std::vector<uint8_t>& tlvStructure,
+                                                     const bool primitiveOnly)
+{
+    return readAll(tlvStructure.data(), tlvStructure.size(), primitiveOnly);
+}
+
+std::vector<BerTlvReader::Tlv> BerTlvReader::readAll(const uint8_t* data,
+                                                     const size_t length,
+                                                     const bool primitiveOnly)
+{
+    Tlv tlv;
+    size_t count = 0;
+
+    /* First pass to size the result (headers only, cheap) */
+    BerTlvReader counter(data, length);
+    while (counter.next(tlv)) {
+        if (!primitiveOnly || !tlv.constructed) {
+            count++;
+        }
+    }
+
+    std::vector<Tlv> tlvs;
+    tlvs.reserve(count);
+
+    BerTlvReader reader(data, length);
+    while (reader.next(tlv)) {
+        if (!primitiveOnly || !tlv.constructed) {
+            tlvs.push_back(tlv);
+        }
+    }
+
+    return tlvs;
+}
+
+BerTlvReader::Error BerTlvReader::decodeHeader(const uint8_t* data,
+                                               const size_t end,
+                                               const size_t offset,
+                                               Tlv& tlv)
+{
+    size_t i = offset;
+
+    /* Tag field: 1 to 4 bytes, the subsequent bytes having b8 set except the last one */
+    if (i >= end) {
+        return Error::OUT_OF_BOUNDS;
+    }
+
+    const uint8_t firstByte = data[i++];
+    uint32_t tag = firstByte;
+
+    if ((firstByte & 0x1F) == 0x1F) {
+        uint8_t subsequentByte;
+
+        do {
+            if (i - offset == MAX_TAG_SIZE) {
+                return Error::INVALID_TAG;
+            }
+
+            if (i >= end) {
+                return Error::OUT_OF_BOUNDS;
+            }
+
+            subsequentByte = data[i++];
+            tag = (tag << 8) | subsequentByte;
+        } while ((subsequentByte & 0x80) != 0);
+    }
+
+    /* Length field: short form, or 81h to 84h followed by 1 to 4 bytes */
+    if (i >= end) {
+        return Error::OUT_OF_BOUNDS;
+    }
+
+    size_t length = data[i++];
+
+    if (length >= 0x80) {
+        const size_t lengthSize = length & 0x7F;
+
+        if (lengthSize == 0 || lengthSize > MAX_LENGTH_SIZE - 1) {
+            return Error::INVALID_LENGTH;
+        }
+
+        if (end - i < lengthSize) {
+            return Error::OUT_OF_BOUNDS;
+        }
+
+        length = 0;
+        for (size_t k = 0; k < lengthSize; k++) {
+            length = (length << 8) | data[i++];
+        }
+    }
+
+    /* Value */
+    if (end - i < length) {
+        return Error::OUT_OF_BOUNDS;
+    }
+
+    tlv.tag = static_cast<int>(tag);
+    tlv.offset = offset;
+    tlv.valueOffset = i;
+    tlv.valueLength = length;
+    tlv.constructed = (firstByte & 0x20) != 0;
+
+    return Error::NONE;
+}
+
+}
+}
+}
@@ -0,0 +1,274 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Zero-copy reader of BER-TLV encoded data.
+ *
+ * <p>Unlike {@link BerTlvUtil}, no tag value is copied: each TLV is reported as a location (tag,
+ * offset and length of the value) in the parsed buffer, which must therefore outlive the reader
+ * and the reported TLVs. Constructed TLVs are walked in place, their children being reported right
+ * after them (depth-first, document order).
+ *
+ * <p>The tag and length fields follow the same rules as {@link BerTlvUtil}.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BerTlvReader final {
+public:
+    /**
+     * Location of a TLV in the parsed buffer.
+     *
+     * @since 2.4.0
+     */
+    struct Tlv {
+        /**
+         * Tag ID, as an integer (e.g. 0xBF0C), negative for a 4 byte tag ID whose first byte is
+         * greater than 7Fh.
+         */
+        int tag;
+
+        /**
+         * Offset of the first byte of the tag field.
+         */
+        size_t offset;
+
+        /**
+         * Offset of the first byte of the value.
+         */
+        size_t valueOffset;
+
+        /**
+         * Length of the value.
+         */
+        size_t valueLength;
+
+        /**
+         * Nesting level, 0 for the TLVs at the top of the structure.
+         */
+        int depth;
+
+        /**
+         * True if the tag is constructed (its value is made of TLVs).
+         */
+        bool constructed;
+    };
+
+    /**
+     * Reason why a TLV structure is invalid.
+     *
+     * @since 2.4.0
+     */
+    enum class Error {
+        /**
+         * No error.
+         */
+        NONE,
+
+        /**
+         * Tag field longer than 4 bytes.
+         */
+        INVALID_TAG,
+
+        /**
+         * Length field starting with 80h or a value above 84h.
+         */
+        INVALID_LENGTH,
+
+        /**
+         * TLV going beyond the end of the structure or of its enclosing constructed TLV.
+         */
+        OUT_OF_BOUNDS,
+
+        /**
+         * Constructed TLVs nested beyond {@link #MAX_DEPTH}.
+         */
+        TOO_DEEP,
+
+        /**
+         * Empty structure or constructed value (rejected by {@link BerTlvUtil} only).
+         */
+        EMPTY_STRUCTURE
+    };
+
+    /**
+     * Maximum nesting level of constructed TLVs.
+     *
+     * @since 2.4.0
+     */
+    static const int MAX_DEPTH = 32;
+
+    /**
+     * Maximum size of the tag field.
+     *
+     * @since 2.4.0
+     */
+    static const size_t MAX_TAG_SIZE = 4;
+
+    /**
+     * Maximum size of the length field (81h to 84h followed by up to 4 bytes).
+     *
+     * @since 2.4.0
+     */
+    static const size_t MAX_LENGTH_SIZE = 5;
+
+    /**
+     * Creates a reader of the provided TLV structure.
+     *
+     * @param data The TLV structure, must outlive the reader.
+     * @param length The length of the structure.
+     * @since 2.4.0
+     */
+    BerTlvReader(const uint8_t* data, const size_t length);
+
+    /**
+     * Creates a reader of the provided TLV structure.
+     *
+     * @param tlvStructure The TLV structure, must outlive the reader.
+     * @since 2.4.0
+     */
+    explicit BerTlvReader(const std::vector<uint8_t>& tlvStructure);
+
+    /**
+     * Reads the next TLV, a constructed one being followed by its children.
+     *
+     * @param tlv The TLV to fill.
+     * @return False if the end of the structure has been reached.
+     * @throw IllegalArgumentException If the structure is invalid or too deep.
+     * @since 2.4.0
+     */
+    bool next(Tlv& tlv);
+
+    /**
+     * Reads the next TLV without throwing exceptions.
+     *
+     * <p>When an error is reported, the reader stays on the faulty TLV, whose offset is given by
+     * {@link #getOffset()}.
+     *
+     * @param tlv The TLV to fill.
+     * @param error Set to {@link Error#NONE} if the end of the structure has been reached, to the
+     *        reason why the TLV can't be read otherwise.
+     * @return False if the end of the structure has been reached or the TLV is invalid.
+     * @since 2.4.0
+     */
+    bool next(Tlv& tlv, Error& error);
+
+    /**
+     * Skips the children of the last TLV read, if it is constructed, the next TLV read being its
+     * next sibling (or the next sibling of an ancestor).
+     *
+     * <p>The skipped children are neither decoded nor validated.
+     *
+     * @param tlv The last TLV read by {@link #next(Tlv&)}.
+     * @since 2.4.0
+     */
+    void skip(const Tlv& tlv);
+
+    /**
+     * Gets the offset of the next TLV to be read.
+     *
+     * @return An offset in the structure.
+     * @since 2.4.0
+     */
+    size_t getOffset() const;
+
+    /**
+     * Gets a pointer to the value of a TLV read by this reader.
+     *
+     * @param tlv The TLV.
+     * @return A pointer into the parsed buffer.
+     * @since 2.4.0
+     */
+    const uint8_t* getValue(const Tlv& tlv) const;
+
+    /**
+     * Reads all the TLVs, or only the primitive ones, of the provided structure in a single
+     * allocation.
+     *
+     * @param tlvStructure The TLV structure, must outlive the returned TLVs usage.
+     * @param primitiveOnly True if only the primitive TLVs are to be reported.
+     * @return A list of TLVs in document order, empty if the structure is empty.
+     * @throw IllegalArgumentException If the structure is invalid or too deep.
+     * @since 2.4.0
+     */
+    static std::vector<Tlv> readAll(const std::vector<uint8_t>& tlvStructure,
+                                    const bool primitiveOnly);
+
+    /**
+     * Reads all the TLVs, or only the primitive ones, of the provided structure in a single
+     * allocation.
+     *
+     * @param data The TLV structure, must outlive the returned TLVs usage.
+     * @param length The length of the structure.
+     * @param primitiveOnly True if only the primitive TLVs are to be reported.
+     * @return A list of TLVs in document order, empty if the structure is empty.
+     * @throw IllegalArgumentException If the structure is invalid or too deep.
+     * @since 2.4.0
+     */
+    static std::vector<Tlv> readAll(const uint8_t* data,
+                                    const size_t length,
+                                    const bool primitiveOnly);
+
+private:
+    /**
+     *
+     */
+    const uint8_t* mData;
+
+    /**
+     *
+     */
+    const size_t mLength;
+
+    /**
+     * Offset of the next TLV
+     */
+    size_t mOffset;
+
+    /**
+     * Number of constructed TLVs being walked
+     */
+    int mDepth;
+
+    /**
+     * End offsets of the values of the constructed TLVs being walked
+     */
+    size_t mEnds[MAX_DEPTH];
+
+    /**
+     * (private)<br>
+     * Decodes the tag and length fields located at the provided offset.
+     *
+     * @param data The TLV structure.
+     * @param end The offset the TLV (value included) must not go beyond.
+     * @param offset The offset of the tag field.
+     * @param tlv The TLV to fill (depth excepted).
+     * @return The reason why the TLV is invalid, {@link Error#NONE} if it is valid.
+     */
+    static Error decodeHeader(const uint8_t* data, const size_t end, const size_t offset, Tlv& tlv);
+};
+
+}
+}
+}
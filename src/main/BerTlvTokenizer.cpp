@@ -0,0 +1,241 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BerTlvTokenizer.h"
+
+/* Keyple Core Util */
+#include "BerTlvReader.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+const int BerTlvTokenizer::MAX_DEPTH;
+const size_t BerTlvTokenizer::DEFAULT_MAX_VALUE_LENGTH;
+
+BerTlvTokenizer::BerTlvTokenizer() : BerTlvTokenizer(DEFAULT_MAX_VALUE_LENGTH) {}
+
+BerTlvTokenizer::BerTlvTokenizer(const size_t maxValueLength)
+: mMaxValueLength(maxValueLength),
+  mChunk(nullptr),
+  mChunkLength(0),
+  mChunkOffset(0),
+  mPosition(0),
+  mHeaderLength(0),
+  mInValue(false),
+  mValueTag(0),
+  mValueLength(0),
+  mDepth(0) {}
+
+void BerTlvTokenizer::feed(const uint8_t* data, const size_t length)
+{
+    if (mChunkOffset != mChunkLength) {
+        throw IllegalStateException("Previous chunk not fully consumed.");
+    }
+
+    mChunk = data;
+    mChunkLength = length;
+    mChunkOffset = 0;
+}
+
+void BerTlvTokenizer::feed(const std::vector<uint8_t>& data)
+{
+    feed(data.data(), data.size());
+}
+
+bool BerTlvTokenizer::next(Event& event)
+{
+    for (;;) {
+        const size_t available = mChunkLength - mChunkOffset;
+
+        /* Value of a primitive TLV split across chunks */
+        if (mInValue) {
+            const size_t missing = mValueLength - mValue.size();
+            const size_t count = available < missing ? available : missing;
+
+            mValue.insert(mValue.end(), mChunk + mChunkOffset, mChunk + mChunkOffset + count);
+            mChunkOffset += count;
+            mPosition += count;
+
+            if (mValue.size() < mValueLength) {
+                return false;
+            }
+
+            mInValue = false;
+
+            event.type = EventType::PRIMITIVE;
+            event.tag = mValueTag;
+            event.length = mValueLength;
+            event.value = mValue.data();
+            event.depth = mDepth;
+
+            return true;
+        }
+
+        if (mDepth > 0 && mPosition == mEnds[mDepth - 1]) {
+            /* A TLV header can't overlap the end of its parent */
+            if (mHeaderLength != 0) {
+                throw IllegalArgumentException("Invalid TLV structure.");
+            }
+
+            mDepth--;
+
+            event.type = EventType::END_CONSTRUCTED;
+            event.tag = mTags[mDepth];
+            event.length = 0;
+            event.value = nullptr;
+            event.depth = mDepth;
+
+            return true;
+        }
+
+        if (available == 0) {
+            return false;
+        }
+
+        /* Tag and length fields, received byte by byte as they are at most 9 bytes long */
+        mHeader[mHeaderLength++] = mChunk[mChunkOffset++];
+        mPosition++;
+
+        int tag;
+        size_t length;
+
+        if (!decodeHeader(tag, length)) {
+            continue;
+        }
+
+        mHeaderLength = 0;
+
+        if (mDepth > 0 && mEnds[mDepth - 1] - mPosition < length) {
+            throw IllegalArgumentException("Invalid TLV structure.");
+        }
+
+        event.tag = tag;
+        event.length = length;
+        event.depth = mDepth;
+
+        if ((mHeader[0] & 0x20) != 0) {
+            if (mDepth == MAX_DEPTH) {
+                throw IllegalArgumentException("TLV structure too deep.");
+            }
+
+            mEnds[mDepth] = mPosition + length;
+            mTags[mDepth] = tag;
+            mDepth++;
+
+            event.type = EventType::START_CONSTRUCTED;
+            event.value = nullptr;
+
+            return true;
+        }
+
+        /* Checked whatever the chunking, before any buffering */
+        if (length > mMaxValueLength) {
+            throw IllegalArgumentException("TLV value too long.");
+        }
+
+        if (mChunkLength - mChunkOffset >= length) {
+            /* Value entirely in the current chunk: not copied */
+            event.type = EventType::PRIMITIVE;
+            event.value = mChunk + mChunkOffset;
+
+            mChunkOffset += length;
+            mPosition += length;
+
+            return true;
+        }
+
+        mInValue = true;
+        mValueTag = tag;
+        mValueLength = length;
+        mValue.clear();
+        mValue.reserve(length);
+    }
+}
+
+bool BerTlvTokenizer::isComplete() const
+{
+    return mDepth == 0 && mHeaderLength == 0 && !mInValue;
+}
+
+void BerTlvTokenizer::reset()
+{
+    mChunk = nullptr;
+    mChunkLength = 0;
+    mChunkOffset = 0;
+    mPosition = 0;
+    mHeaderLength = 0;
+    mInValue = false;
+    mDepth = 0;
+}
+
+bool BerTlvTokenizer::decodeHeader(int& tag, size_t& length) const
+{
+    size_t i = 0;
+
+    /* Tag field: 1 to 4 bytes, the subsequent bytes having b8 set except the last one */
+    const uint8_t firstByte = mHeader[i++];
+    uint32_t value = firstByte;
+
+    if ((firstByte & 0x1F) == 0x1F) {
+        uint8_t subsequentByte;
+
+        do {
+            if (i >= mHeaderLength) {
+                return false;
+            }
+
+            if (i == BerTlvReader::MAX_TAG_SIZE) {
+                throw IllegalArgumentException("Invalid TLV structure.");
+            }
+
+            subsequentByte = mHeader[i++];
+            value = (value << 8) | subsequentByte;
+        } while ((subsequentByte & 0x80) != 0);
+    }
+
+    tag = static_cast<int>(value);
+
+    /* Length field: short form, or 81h to 84h followed by 1 to 4 bytes */
+    if (i >= mHeaderLength) {
+        return false;
+    }
+
+    length = mHeader[i++];
+
+    if (length >= 0x80) {
+        const size_t lengthSize = length & 0x7F;
+
+        if (lengthSize == 0 || lengthSize > BerTlvReader::MAX_LENGTH_SIZE - 1) {
+            throw IllegalArgumentException("Invalid TLV structure.");
+        }
+
+        if (mHeaderLength - i < lengthSize) {
+            return false;
+        }
+
+        length = 0;
+        for (size_t k = 0; k < lengthSize; k++) {
+            length = (length << 8) | mHeader[i++];
+        }
+    }
+
+    return true;
+}
+
+}
+}
+}
@@ -0,0 +1,273 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Resumable tokenizer of BER-TLV encoded data received in fragments (e.g. chained GET RESPONSE
+ * commands).
+ *
+ * <p>The data is provided chunk by chunk with {@link #feed(const uint8_t*, const size_t)}, then
+ * the events that can be completed with the bytes received so far are pulled with {@link
+ * #next(Event&)}:
+ *
+ * <pre>
+ * tokenizer.feed(chunk, chunkLength);
+ * while (tokenizer.next(event)) {
+ *     ...
+ * }
+ * </pre>
+ *
+ * <p>Only bounded state is kept between two chunks: the nesting of the constructed TLVs being
+ * read, an incomplete tag and length field, and the value of a primitive TLV split across chunks,
+ * whose length is limited (see {@link #DEFAULT_MAX_VALUE_LENGTH}). The whole structure is never
+ * buffered.
+ *
+ * <p>The tag and length fields follow the same rules as {@link BerTlvUtil}.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BerTlvTokenizer final {
+public:
+    /**
+     * Kind of event.
+     *
+     * @since 2.4.0
+     */
+    enum class EventType {
+        /**
+         * Tag and length of a constructed TLV, followed by the events of its children.
+         */
+        START_CONSTRUCTED,
+
+        /**
+         * Complete primitive TLV.
+         */
+        PRIMITIVE,
+
+        /**
+         * End of the value of a constructed TLV.
+         */
+        END_CONSTRUCTED
+    };
+
+    /**
+     * TLV event.
+     *
+     * @since 2.4.0
+     */
+    struct Event {
+        /**
+         * Kind of event.
+         */
+        EventType type;
+
+        /**
+         * Tag ID, as an integer (e.g. 0xBF0C).
+         */
+        int tag;
+
+        /**
+         * Length of the value.
+         */
+        size_t length;
+
+        /**
+         * Value of a primitive TLV, valid until the next call to {@link #next(Event&)} or {@link
+         * #feed(const uint8_t*, const size_t)}; null for the other events.
+         */
+        const uint8_t* value;
+
+        /**
+         * Nesting level, 0 for the TLVs at the top of the structure.
+         */
+        int depth;
+    };
+
+    /**
+     * Maximum nesting level of constructed TLVs.
+     *
+     * @since 2.4.0
+     */
+    static const int MAX_DEPTH = 32;
+
+    /**
+     * Default maximum length of the value of a primitive TLV (maximum length of an extended APDU
+     * response).
+     *
+     * @since 2.4.0
+     */
+    static const size_t DEFAULT_MAX_VALUE_LENGTH = 65536;
+
+    /**
+     * Creates a tokenizer waiting for the beginning of a TLV structure, accepting primitive values
+     * up to {@link #DEFAULT_MAX_VALUE_LENGTH} bytes.
+     *
+     * @since 2.4.0
+     */
+    BerTlvTokenizer();
+
+    /**
+     * Creates a tokenizer waiting for the beginning of a TLV structure.
+     *
+     * @param maxValueLength The maximum length of the value of a primitive TLV, i.e. the maximum
+     *        number of bytes buffered when a value is split across chunks.
+     * @since 2.4.0
+     */
+    explicit BerTlvTokenizer(const size_t maxValueLength);
+
+    /**
+     * Provides the next chunk of data.
+     *
+     * <p>The chunk is not copied and must stay valid until {@link #next(Event&)} returns false.
+     *
+     * @param data The chunk.
+     * @param length The length of the chunk.
+     * @throw IllegalStateException If the previous chunk has not been fully consumed.
+     * @since 2.4.0
+     */
+    void feed(const uint8_t* data, const size_t length);
+
+    /**
+     * Provides the next chunk of data.
+     *
+     * @param data The chunk, must stay valid until {@link #next(Event&)} returns false.
+     * @throw IllegalStateException If the previous chunk has not been fully consumed.
+     * @since 2.4.0
+     */
+    void feed(const std::vector<uint8_t>& data);
+
+    /**
+     * Gets the next event that can be completed with the data received so far.
+     *
+     * @param event The event to fill.
+     * @return False if more data is needed.
+     * @throw IllegalArgumentException If the structure is invalid or too deep, or if the length of
+     *        a primitive value exceeds the maximum.
+     * @since 2.4.0
+     */
+    bool next(Event& event);
+
+    /**
+     * Indicates whether all the TLVs started have been fully read.
+     *
+     * <p>To be checked once {@link #next(Event&)} returns false after the last chunk.
+     *
+     * @return True if the structure received so far is complete.
+     * @since 2.4.0
+     */
+    bool isComplete() const;
+
+    /**
+     * Discards the current state, to tokenize a new structure.
+     *
+     * @since 2.4.0
+     */
+    void reset();
+
+private:
+    /**
+     *
+     */
+    const size_t mMaxValueLength;
+
+    /**
+     * Current chunk
+     */
+    const uint8_t* mChunk;
+
+    /**
+     *
+     */
+    size_t mChunkLength;
+
+    /**
+     * Offset of the next byte to consume in the current chunk
+     */
+    size_t mChunkOffset;
+
+    /**
+     * Number of bytes consumed since the beginning of the structure
+     */
+    uint64_t mPosition;
+
+    /**
+     * Tag and length fields being received (up to 4 and 5 bytes)
+     */
+    uint8_t mHeader[9];
+
+    /**
+     *
+     */
+    size_t mHeaderLength;
+
+    /**
+     * True while receiving the value of a primitive TLV split across chunks
+     */
+    bool mInValue;
+
+    /**
+     *
+     */
+    int mValueTag;
+
+    /**
+     *
+     */
+    size_t mValueLength;
+
+    /**
+     * Part of the primitive value received so far
+     */
+    std::vector<uint8_t> mValue;
+
+    /**
+     * Number of constructed TLVs being read
+     */
+    int mDepth;
+
+    /**
+     * End positions of the values of the constructed TLVs being read
+     */
+    uint64_t mEnds[MAX_DEPTH];
+
+    /**
+     * Tags of the constructed TLVs being read
+     */
+    int mTags[MAX_DEPTH];
+
+    /**
+     * (private)<br>
+     * Decodes the tag and length fields received so far.
+     *
+     * @param tag The tag to fill.
+     * @param length The length to fill.
+     * @return False if more bytes are needed.
+     * @throw IllegalArgumentException If the fields are invalid.
+     */
+    bool decodeHeader(int& tag, size_t& length) const;
+};
+
+}
+}
+}
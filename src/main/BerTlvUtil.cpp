@@ -12,16 +12,15 @@
 
 #include "BerTlvUtil.h"
 
+#include <algorithm>
+
 /* Keyple Core Util */
-#include "Arrays.h"
 #include "IllegalArgumentException.h"
-#include "IndexOutOfBoundsException.h"
 
 namespace keyple {
 namespace core {
 namespace util {
 
-using namespace keyple::core::util::cpp;
 using namespace keyple::core::util::cpp::exception;
 
 BerTlvUtil::BerTlvUtil() {}
@@ -29,209 +28,234 @@ BerTlvUtil::BerTlvUtil() {}
 const std::map<const int, const std::vector<uint8_t>> BerTlvUtil::parseSimple(
     const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly)
 {
-    try {
-        return parseBufferSimple(tlvStructure, primitiveOnly);
-    } catch (const IndexOutOfBoundsException& e) {
-        (void)e;
-        throw IllegalArgumentException("Invalid TLV structure.");
-    }
+    std::map<const int, const std::vector<uint8_t>> tlvs;
+
+    checkResult(tryParseSimple(tlvStructure, primitiveOnly, tlvs));
+
+    return tlvs;
 }
 
 const std::map<const int, std::vector<std::vector<uint8_t>>> BerTlvUtil::parse(
     const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly)
 {
-    try {
-        return parseBuffer(tlvStructure, primitiveOnly);
-    } catch (const IndexOutOfBoundsException& e) {
-        (void)e;
-        throw IllegalArgumentException("Invalid TLV structure.");
-    }
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    checkResult(tryParse(tlvStructure, primitiveOnly, tlvs));
+
+    return tlvs;
 }
 
-bool BerTlvUtil::isConstructed(const int tagId)
+BerTlvUtil::ArenaMap BerTlvUtil::parse(const std::vector<uint8_t>& tlvStructure,
+                                       const bool primitiveOnly,
+                                       MonotonicBuffer& buffer)
 {
-    if (tagId < 0 || tagId > 0xFFFFFF) {
-        throw IllegalArgumentException("Tag Id out of range.");
-    }
+    const MonotonicBuffer::Allocator<uint8_t> allocator(buffer);
+    ArenaMap tlvs(std::less<const int>(), allocator);
+    ParseResult result = {BerTlvReader::Error::NONE, 0};
+    BerTlvReader reader(tlvStructure);
+    BerTlvReader::Tlv tlv;
+
+    while (readNext(reader, tlv, result)) {
+        if (!primitiveOnly || !tlv.constructed) {
+            auto it = tlvs.find(tlv.tag);
+            if (it == tlvs.end()) {
+                it = tlvs.insert({tlv.tag, ArenaValues(allocator)}).first;
+            }
 
-    if (tagId <= 0xFF) {
-        return (tagId & 0x20) != 0;
+            const uint8_t* value = reader.getValue(tlv);
+            it->second.emplace_back(value, value + tlv.valueLength, allocator);
+        }
     }
 
-    if (tagId <= 0xFFFF) {
-        return (tagId & 0x2000) != 0;
-    }
+    checkResult(result);
 
-    return (tagId & 0x200000) != 0;
+    return tlvs;
 }
 
-const std::map<const int, const std::vector<uint8_t>> BerTlvUtil::parseBufferSimple(
-    const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly)
+const std::map<const int, const std::vector<uint8_t>> BerTlvUtil::findTags(
+    const std::vector<uint8_t>& tlvStructure, const std::vector<int>& tags, const int maxDepth)
 {
-
     std::map<const int, const std::vector<uint8_t>> tlvs;
-    int offset = 0;
-
-    do {
-        const int tagSize = getTagSize(tlvStructure, offset);
-        const std::vector<uint8_t> tagBytes =
-            Arrays::copyOfRange(tlvStructure, offset, offset + tagSize);
-        const int tag = getTag(tlvStructure, offset, tagSize);
-        const int lengthSize = getLengthSize(tlvStructure, offset + tagSize);
-        const int valueSize = getLength(tlvStructure, offset + tagSize, lengthSize);
-        const std::vector<uint8_t> value =
-            Arrays::copyOfRange(tlvStructure,
-                                offset + tagSize + lengthSize,
-                                offset + tagSize + lengthSize + valueSize);
-
-        offset += tagSize + lengthSize + valueSize;
-
-        if ((tagBytes[0] & 0x20) != 0) {
-            /* Tag is constructed */
-            if (!primitiveOnly) {
-                tlvs.insert({tag, value});
-            }
+    ParseResult result = {BerTlvReader::Error::NONE, 0};
+    BerTlvReader reader(tlvStructure);
+    BerTlvReader::Tlv tlv;
+    const size_t requestedCount = countDistinct(tags);
+
+    /* Stops as soon as all the requested tags have been found */
+    while ((tags.empty() || tlvs.size() < requestedCount) && readNext(reader, tlv, result)) {
+        if (isRequested(tags, tlv.tag) && tlvs.find(tlv.tag) == tlvs.end()) {
+            const uint8_t* value = reader.getValue(tlv);
+            tlvs.insert({tlv.tag, std::vector<uint8_t>(value, value + tlv.valueLength)});
+        }
 
-            const std::map<const int, const std::vector<uint8_t>> parse =
-                parseSimple(value, primitiveOnly);
-            tlvs.insert(parse.begin(), parse.end());
-        } else {
-            /* Tag is primitive */
-            tlvs.insert({tag, value});
+        if (tlv.depth >= maxDepth) {
+            reader.skip(tlv);
         }
-    } while (offset < static_cast<int>(tlvStructure.size()));
+    }
+
+    checkResult(result);
 
     return tlvs;
 }
 
-const std::map<const int, std::vector<std::vector<uint8_t>>> BerTlvUtil::parseBuffer(
-    const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly)
+const std::map<const int, std::vector<std::vector<uint8_t>>> BerTlvUtil::findAllTags(
+    const std::vector<uint8_t>& tlvStructure, const std::vector<int>& tags, const int maxDepth)
 {
     std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
-    int offset = 0;
-
-    do {
-        const int tagSize = getTagSize(tlvStructure, offset);
-        const std::vector<uint8_t> tagBytes =
-            Arrays::copyOfRange(tlvStructure, offset, offset + tagSize);
-        const int tag = getTag(tlvStructure, offset, tagSize);
-        const int lengthSize = getLengthSize(tlvStructure, offset + tagSize);
-        const int valueSize = getLength(tlvStructure, offset + tagSize, lengthSize);
-        const std::vector<uint8_t> value =
-            Arrays::copyOfRange(tlvStructure,
-                                offset + tagSize + lengthSize,
-                                offset + tagSize + lengthSize + valueSize);
-
-        offset += tagSize + lengthSize + valueSize;
-
-        if ((tagBytes[0] & 0x20) != 0) {
-            /* Tag is constructed */
-            if (!primitiveOnly) {
-                std::vector<std::vector<uint8_t>>& values = getOrInitTagValues(tlvs, tag);
-                values.push_back(value);
-            }
-
-            std::map<const int, std::vector<std::vector<uint8_t>>> tlvs2 =
-                parse(value, primitiveOnly);
+    ParseResult result = {BerTlvReader::Error::NONE, 0};
+    BerTlvReader reader(tlvStructure);
+    BerTlvReader::Tlv tlv;
+
+    while (readNext(reader, tlv, result)) {
+        if (isRequested(tags, tlv.tag)) {
+            const uint8_t* value = reader.getValue(tlv);
+            tlvs[tlv.tag].emplace_back(value, value + tlv.valueLength);
+        }
 
-            for (const auto & entry : tlvs2) {
-                std::vector<std::vector<uint8_t>>& values = getOrInitTagValues(tlvs, entry.first);
-                Arrays::addAll(values, entry.second);
-            }
-        } else {
-            /* Tag is primitive */
-            std::vector<std::vector<uint8_t>>& values = getOrInitTagValues(tlvs, tag);
-            values.push_back(value);
+        if (tlv.depth >= maxDepth) {
+            reader.skip(tlv);
         }
+    }
 
-    } while (offset < static_cast<int>(tlvStructure.size()));
+    checkResult(result);
 
     return tlvs;
 }
 
-std::vector<std::vector<uint8_t>>& BerTlvUtil::getOrInitTagValues(
-    std::map<const int, std::vector<std::vector<uint8_t>>>& tlvs, const int tag)
+BerTlvUtil::ParseResult BerTlvUtil::tryParseSimple(
+    const std::vector<uint8_t>& tlvStructure,
+    const bool primitiveOnly,
+    std::map<const int, const std::vector<uint8_t>>& tlvs)
 {
-    const auto it = tlvs.find(tag);
+    ParseResult result = {BerTlvReader::Error::NONE, 0};
+    BerTlvReader reader(tlvStructure);
+    BerTlvReader::Tlv tlv;
+
+    tlvs.clear();
+
+    /* Single walk in document order, only the first occurrence of each tag being kept */
+    while (readNext(reader, tlv, result)) {
+        if ((!primitiveOnly || !tlv.constructed) && tlvs.find(tlv.tag) == tlvs.end()) {
+            const uint8_t* value = reader.getValue(tlv);
+            tlvs.insert({tlv.tag, std::vector<uint8_t>(value, value + tlv.valueLength)});
+        }
+    }
 
-    if (it == tlvs.end()) {
-      std::vector<std::vector<uint8_t>> values;
-      tlvs.insert({tag, values});
+    if (result.error != BerTlvReader::Error::NONE) {
+        tlvs.clear();
     }
 
-    /* Look again and return reference */
-    return tlvs.find(tag)->second;
+    return result;
 }
 
-int BerTlvUtil::getTagSize(const std::vector<uint8_t>& tlvStructure, const int offset)
+BerTlvUtil::ParseResult BerTlvUtil::tryParse(
+    const std::vector<uint8_t>& tlvStructure,
+    const bool primitiveOnly,
+    std::map<const int, std::vector<std::vector<uint8_t>>>& tlvs)
 {
-    /* C++: prevent accessing unexisting values */
-    if (offset >= static_cast<int>(tlvStructure.size())) {
-        throw IndexOutOfBoundsException("Invalid index");
-    }
+    ParseResult result = {BerTlvReader::Error::NONE, 0};
+    BerTlvReader reader(tlvStructure);
+    BerTlvReader::Tlv tlv;
 
-    if ((tlvStructure[offset] & 0x1F) == 0x1F) {
-        if ((tlvStructure[offset + 1] & 0x80) == 0) {
-            return 2;
-        } else {
-            if ((tlvStructure[offset + 2] & 0x80) != 0) {
-                throw IllegalArgumentException("Invalid tag.");
-            }
+    tlvs.clear();
+
+    /* Single walk in document order, the constructed TLVs being followed by their children */
+    while (readNext(reader, tlv, result)) {
+        if (!primitiveOnly || !tlv.constructed) {
+            const uint8_t* value = reader.getValue(tlv);
+            tlvs[tlv.tag].emplace_back(value, value + tlv.valueLength);
         }
+    }
 
-        return 3;
-    } else {
-        return 1;
+    if (result.error != BerTlvReader::Error::NONE) {
+        tlvs.clear();
     }
+
+    return result;
 }
 
-int BerTlvUtil::getTag(const std::vector<uint8_t>& tlvStructure, const int offset, const int size)
+bool BerTlvUtil::isConstructed(const int tagId)
 {
-    switch (size) {
-    case 1:
-        return tlvStructure[offset] & 0xFF;
-    case 2:
-        return ((tlvStructure[offset] & 0xFF) << 8) + (tlvStructure[offset + 1] & 0xFF);
-    case 3:
-        return ((tlvStructure[offset] & 0xFF) << 16)
-            + ((tlvStructure[offset + 1] & 0xFF) << 8)
-            + (tlvStructure[offset + 2] & 0xFF);
-    default:
-        throw IllegalArgumentException("Bad tag size.");
+    const uint32_t tag = static_cast<uint32_t>(tagId);
+
+    if (tag <= 0xFF) {
+        return (tag & 0x20) != 0;
+    }
+
+    if (tag <= 0xFFFF) {
+        return (tag & 0x2000) != 0;
+    }
+
+    if (tag <= 0xFFFFFF) {
+        return (tag & 0x200000) != 0;
     }
+
+    /* 4 bytes: subsequent bytes announced by the first one, b8 set on all of them but the last */
+    if ((tag & 0x1F808080) != 0x1F808000) {
+        throw IllegalArgumentException("Tag Id out of range.");
+    }
+
+    return (tag & 0x20000000) != 0;
 }
 
-int BerTlvUtil::getLengthSize(const std::vector<uint8_t>& tlvStructure, const int offset)
+bool BerTlvUtil::readNext(BerTlvReader& reader, BerTlvReader::Tlv& tlv, ParseResult& result)
 {
-    int firstByteLength = tlvStructure[offset] & 0xff;
-
-    switch (firstByteLength) {
-    case 0x82:
-        return 3;
-    case 0x81:
-        return 2;
-    default:
-        if (firstByteLength >= 0x80) {
-            throw IllegalArgumentException("Invalid length.");
+    /* As an empty constructed value, an empty structure is not a valid TLV structure */
+    const bool first = reader.getOffset() == 0;
+
+    if (!reader.next(tlv, result.error)) {
+        if (result.error != BerTlvReader::Error::NONE) {
+            result.errorOffset = reader.getOffset();
+        } else if (first) {
+            result.error = BerTlvReader::Error::EMPTY_STRUCTURE;
         }
 
-        return 1;
+        return false;
     }
+
+    if (tlv.constructed && tlv.valueLength == 0) {
+        result.error = BerTlvReader::Error::EMPTY_STRUCTURE;
+        result.errorOffset = tlv.offset;
+
+        return false;
+    }
+
+    return true;
 }
 
-int BerTlvUtil::getLength(const std::vector<uint8_t>& tlvStructure,
-                          const int offset,
-                          const int size)
+bool BerTlvUtil::isRequested(const std::vector<int>& tags, const int tag)
 {
-    switch (size) {
-    case 1:
-        return tlvStructure[offset] & 0x7F;
-    case 2:
-        return tlvStructure[offset + 1] & 0xFF;
-    case 3:
-        return ((tlvStructure[offset + 1] & 0xFF) << 8) + (tlvStructure[offset + 2] & 0xFF);
+    if (tags.empty()) {
+        return true;
+    }
+
+    for (const int requested : tags) {
+        if (requested == tag) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+size_t BerTlvUtil::countDistinct(const std::vector<int>& tags)
+{
+    std::vector<int> sortedTags(tags);
+    std::sort(sortedTags.begin(), sortedTags.end());
+
+    return static_cast<size_t>(std::unique(sortedTags.begin(), sortedTags.end()) -
+                               sortedTags.begin());
+}
+
+void BerTlvUtil::checkResult(const ParseResult& result)
+{
+    switch (result.error) {
+    case BerTlvReader::Error::NONE:
+        return;
+    case BerTlvReader::Error::TOO_DEEP:
+        throw IllegalArgumentException("TLV structure too deep.");
     default:
-        throw IllegalArgumentException("Bad length size.");
+        throw IllegalArgumentException("Invalid TLV structure.");
     }
 }
 
@@ -17,7 +17,9 @@
 #include <cstdint>
 
  /* Core */
+#include "BerTlvReader.h"
 #include "KeypleUtilExport.h"
+#include "MonotonicBuffer.h"
 
 namespace keyple {
 namespace core {
@@ -30,16 +32,59 @@ namespace util {
  * encountered in smart card data, it has the following limitations:
  *
  * <ul>
- *   <li>The tag ID fields must not exceed 3 bytes.
- *   <li>The length fields must not exceed 3 bytes.
+ *   <li>The tag ID fields must not exceed 4 bytes.
+ *   <li>The length fields must not exceed 5 bytes (definite forms only).
  *   <li>Tags present several times in the same TLV structure require special attention (see {@link
  *       #parseSimple(byte[], boolean)}).
  * </ul>
  *
+ * <p>See {@link BerTlvReader} to locate the tags in the structure without copying their values.
+ *
  * @since 2.0.0
  */
 class KEYPLEUTIL_API BerTlvUtil {
 public:
+    /**
+     * Outcome of a parsing that does not throw exceptions.
+     *
+     * @since 2.4.0
+     */
+    struct ParseResult {
+        /**
+         * Reason why the structure is invalid, {@link BerTlvReader::Error#NONE} if it is valid.
+         */
+        BerTlvReader::Error error;
+
+        /**
+         * Offset of the faulty TLV in the structure, 0 if the structure is valid.
+         */
+        size_t errorOffset;
+    };
+
+    /**
+     * Tag value allocated from a monotonic buffer.
+     *
+     * @since 2.4.0
+     */
+    typedef std::vector<uint8_t, MonotonicBuffer::Allocator<uint8_t>> ArenaValue;
+
+    /**
+     * Tag values allocated from a monotonic buffer.
+     *
+     * @since 2.4.0
+     */
+    typedef std::vector<ArenaValue, MonotonicBuffer::Allocator<ArenaValue>> ArenaValues;
+
+    /**
+     * Map of tags allocated from a monotonic buffer (nodes and values).
+     *
+     * @since 2.4.0
+     */
+    typedef std::map<const int,
+                     ArenaValues,
+                     std::less<const int>,
+                     MonotonicBuffer::Allocator<std::pair<const int, ArenaValues>>> ArenaMap;
+
     /**
      * Parse the provided TLV structure and place all or only primitive tags found in a map. The key
      * is an integer representing the tag ID (e.g. 0x84 for the DF name tag), the value is the tag
@@ -75,108 +120,143 @@ public:
         const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly);
 
     /**
-     * Indicates if the provided tag ID corresponds to a constructed tag.
+     * Same as {@link #parse(const std::vector<uint8_t>&, const bool)}, all the nodes and values of
+     * the map being allocated from the provided buffer.
      *
-     * @param tagId A positive int less than FFFFFFh.
-     * @return True if the tag is constructed.
-     * @throw IllegalArgumentException If the tag ID is out of range.
-     * @since 2.0.0
+     * <p>The map must be destroyed before the buffer is released.
+     *
+     * @param tlvStructure The input TLV structure.
+     * @param primitiveOnly True if only primitives tags are to be placed in the map.
+     * @param buffer The buffer to allocate from.
+     * @return A not null map.
+     * @throw IllegalArgumentException If the parsing of the provided structure failed.
+     * @since 2.4.0
      */
-    static bool isConstructed(const int tagId);
+    static ArenaMap parse(const std::vector<uint8_t>& tlvStructure,
+                          const bool primitiveOnly,
+                          MonotonicBuffer& buffer);
 
-private:
     /**
-     * (private)
+     * Looks for the first occurrence of some tags, down to a given depth.
+     *
+     * <p>The constructed TLVs located at the maximum depth are skipped without being walked, and
+     * the parsing stops as soon as all the requested tags have been found (the rest of the
+     * structure is not validated).
+     *
+     * @param tlvStructure The input TLV structure.
+     * @param tags The requested tag IDs, all tags if empty.
+     * @param maxDepth The nesting level beyond which the TLVs are ignored (0 for the top level
+     *        only).
+     * @return A map of the requested tags found.
+     * @throw IllegalArgumentException If the parsing of the provided structure failed.
+     * @since 2.4.0
      */
-    BerTlvUtil();
+    static const std::map<const int, const std::vector<uint8_t>> findTags(
+        const std::vector<uint8_t>& tlvStructure,
+        const std::vector<int>& tags,
+        const int maxDepth = BerTlvReader::MAX_DEPTH);
 
     /**
-     * (private)<br>
-     * Parse the provided TLV structure from the provided offset and place all or only primitive tags
-     * found in a map.
+     * Looks for all the occurrences of some tags, down to a given depth.
+     *
+     * <p>The constructed TLVs located at the maximum depth are skipped without being walked.
+     *
+     * @param tlvStructure The input TLV structure.
+     * @param tags The requested tag IDs, all tags if empty.
+     * @param maxDepth The nesting level beyond which the TLVs are ignored (0 for the top level
+     *        only).
+     * @return A map of the requested tags found.
+     * @throw IllegalArgumentException If the parsing of the provided structure failed.
+     * @since 2.4.0
+     */
+    static const std::map<const int, std::vector<std::vector<uint8_t>>> findAllTags(
+        const std::vector<uint8_t>& tlvStructure,
+        const std::vector<int>& tags,
+        const int maxDepth = BerTlvReader::MAX_DEPTH);
+
+    /**
+     * Same as {@link #parseSimple(const std::vector<uint8_t>&, const bool)}, the errors being
+     * reported in the returned result instead of an exception.
      *
      * @param tlvStructure The input TLV structure.
      * @param primitiveOnly True if only primitives tags are to be placed in the map.
-     * @return A not null map.
+     * @param tlvs The map to fill, cleared first and left empty if the structure is invalid.
+     * @return The reason and the location of the error, if any.
+     * @since 2.4.0
      */
-    static const std::map<const int, const std::vector<uint8_t>> parseBufferSimple(
-        const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly);
+    static ParseResult tryParseSimple(const std::vector<uint8_t>& tlvStructure,
+                                      const bool primitiveOnly,
+                                      std::map<const int, const std::vector<uint8_t>>& tlvs);
 
     /**
-      * (private)<br>
-      * Parse the provided TLV structure from the provided offset and place all or only primitive
-      * tags found in a map.
-      *
-      * @param tlvStructure The input TLV structure.
-      * @param primitiveOnly True if only primitives tags are to be placed in the map.
-      * @return A not null map.
-      */
-    static const std::map<const int, std::vector<std::vector<uint8_t>>> parseBuffer(
-        const std::vector<uint8_t>& tlvStructure, const bool primitiveOnly);
+     * Same as {@link #parse(const std::vector<uint8_t>&, const bool)}, the errors being reported
+     * in the returned result instead of an exception.
+     *
+     * @param tlvStructure The input TLV structure.
+     * @param primitiveOnly True if only primitives tags are to be placed in the map.
+     * @param tlvs The map to fill, cleared first and left empty if the structure is invalid.
+     * @return The reason and the location of the error, if any.
+     * @since 2.4.0
+     */
+    static ParseResult tryParse(const std::vector<uint8_t>& tlvStructure,
+                                const bool primitiveOnly,
+                                std::map<const int, std::vector<std::vector<uint8_t>>>& tlvs);
 
     /**
-     * (private)<br>
-     * Gets a reference to the values of the existing tag in the map, or put the new tag in the map
-     * with an empty list of values.
+     * Indicates if the provided tag ID corresponds to a constructed tag.
      *
-     * @param tlvs The map.
-     * @param tag The TAG.
-     * @return A not null reference to the associated list of values.
+     * @param tagId A tag ID of 1 to 4 bytes (negative for a 4 byte tag ID whose first byte is
+     *        greater than 7Fh).
+     * @return True if the tag is constructed.
+     * @throw IllegalArgumentException If the tag ID is out of range.
+     * @since 2.0.0
+     */
+    static bool isConstructed(const int tagId);
+
+private:
+    /**
+     * (private)
      */
-    static std::vector<std::vector<uint8_t>>& getOrInitTagValues(
-        std::map<const int, std::vector<std::vector<uint8_t>>>& tlvs, const int tag);
+    BerTlvUtil();
 
     /**
      * (private)<br>
-     * Gets the tag field size.
+     * Reads the next TLV of the structure.
      *
-     * @param tlvStructure The input TLV structure.
-     * @param offset The starting offset in the structure.
-     * @return An int.
-     * @throw IllegalArgumentException If the tag field is invalid.
-     * @throw IndexOutOfBoundsException If offset is out of range for the provided tlvStructure.
+     * @param reader The reader of the structure.
+     * @param tlv The TLV to fill.
+     * @param result The result to update in case of error.
+     * @return False if the end of the structure has been reached or an error occurred.
      */
-    static int getTagSize(const std::vector<uint8_t>& tlvStructure, const int offset);
+    static bool readNext(BerTlvReader& reader, BerTlvReader::Tlv& tlv, ParseResult& result);
 
     /**
      * (private)<br>
-     * Gets, as an integer, the tag of the provided size present at the designated location.
+     * Indicates whether a tag is requested.
      *
-     * @param tlvStructure The input TLV structure.
-     * @param offset The starting offset in the structure.
-     * @param size The tag size.
-     * @return An int representing the tag value.
-     * @throw IllegalArgumentException If the size is wrong.
-     * @throw IndexOutOfBoundsException If offset is out of range for the provided tlvStructure.
+     * @param tags The requested tag IDs, all tags if empty.
+     * @param tag The tag ID.
+     * @return True if the tag is requested.
      */
-    static int getTag(const std::vector<uint8_t>& tlvStructure, const int offset, const int size);
+    static bool isRequested(const std::vector<int>& tags, const int tag);
 
     /**
      * (private)<br>
-     * Gets the length field size.
+     * Counts the distinct requested tags.
      *
-     * @param tlvStructure The input TLV structure.
-     * @param offset The starting offset in the structure.
-     * @return An int between 1 and 3.
-     * @throw IllegalArgumentException If the length field is invalid.
-     * @throw IndexOutOfBoundsException If offset is out of range for the provided tlvStructure.
+     * @param tags The requested tag IDs.
+     * @return The number of distinct tag IDs.
      */
-    static int getLengthSize(const std::vector<uint8_t>& tlvStructure, const int offset);
+    static size_t countDistinct(const std::vector<int>& tags);
 
     /**
      * (private)<br>
-     * Gets, as an integer, the length of the provided size present at the designated location.
+     * Throws the exception associated with the error of the provided result, if any.
      *
-     * @param tlvStructure The input TLV structure.
-     * @param offset The starting offset in the structure.
-     * @param size The tag size.
-     * @return An int representing the length value.
-     * @throw IllegalArgumentException If the size is wrong.
-     * @throw IndexOutOfBoundsException If offset is out of range for the provided tlvStructure.
-     */
-    static int getLength(const std::vector<uint8_t>& tlvStructure,
-                         const int offset,
-                         const int size);
+     * @param result The result.
+     * @throw IllegalArgumentException If the result reports an error.
+     */
+    static void checkResult(const ParseResult& result);
 };
 
 }
@@ -0,0 +1,192 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BerTlvWriter.h"
+
+#include <cstring>
+#include <functional>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+const int BerTlvWriter::MAX_DEPTH;
+
+BerTlvWriter::BerTlvWriter(const size_t capacity) : mDepth(0)
+{
+    mBuffer.reserve(capacity);
+}
+
+BerTlvWriter& BerTlvWriter::add(const int tag, const uint8_t* value, const size_t length)
+{
+    const size_t lengthSize = getLengthSize(length);
+
+    /* The value may be part of the buffer: located by its offset, the buffer may be reallocated */
+    const std::less<const uint8_t*> before;
+    const bool inBuffer = length != 0 &&
+                          !before(value, mBuffer.data()) &&
+                          before(value, mBuffer.data() + mBuffer.size());
+    const size_t valueOffset = inBuffer ? static_cast<size_t>(value - mBuffer.data()) : 0;
+
+    writeTag(tag);
+
+    const size_t offset = mBuffer.size();
+    mBuffer.resize(offset + lengthSize + length);
+    writeLength(&mBuffer[offset], length, lengthSize);
+
+    if (length != 0) {
+        std::memcpy(&mBuffer[offset + lengthSize],
+                    inBuffer ? mBuffer.data() + valueOffset : value,
+                    length);
+    }
+
+    return *this;
+}
+
+BerTlvWriter& BerTlvWriter::add(const int tag, const std::vector<uint8_t>& value)
+{
+    return add(tag, value.data(), value.size());
+}
+
+BerTlvWriter& BerTlvWriter::startConstructed(const int tag)
+{
+    return startConstructed(tag, 0);
+}
+
+BerTlvWriter& BerTlvWriter::startConstructed(const int tag, const size_t sizeHint)
+{
+    uint32_t firstByte = static_cast<uint32_t>(tag);
+    while (firstByte > 0xFF) {
+        firstByte >>= 8;
+    }
+
+    if ((firstByte & 0x20) == 0) {
+        throw IllegalArgumentException("Tag is not constructed.");
+    }
+
+    if (mDepth == MAX_DEPTH) {
+        throw IllegalStateException("TLV structure too deep.");
+    }
+
+    const size_t lengthSize = getLengthSize(sizeHint);
+
+    writeTag(tag);
+
+    /* Placeholder sized after the hint, one byte (short form) without hint */
+    mStarts[mDepth] = mBuffer.size();
+    mLengthSizes[mDepth] = lengthSize;
+    mDepth++;
+    mBuffer.resize(mBuffer.size() + lengthSize);
+
+    return *this;
+}
+
+BerTlvWriter& BerTlvWriter::endConstructed()
+{
+    if (mDepth == 0) {
+        throw IllegalStateException("No constructed TLV open.");
+    }
+
+    mDepth--;
+
+    const size_t start = mStarts[mDepth];
+    const size_t reservedSize = mLengthSizes[mDepth];
+    const size_t length = mBuffer.size() - start - reservedSize;
+    const size_t lengthSize = getLengthSize(length);
+
+    /* Placeholder of the wrong width: the value is shifted once, when the TLV is closed */
+    if (lengthSize > reservedSize) {
+        mBuffer.insert(mBuffer.begin() + start + reservedSize, lengthSize - reservedSize, 0);
+    } else if (lengthSize < reservedSize) {
+        mBuffer.erase(mBuffer.begin() + start + lengthSize, mBuffer.begin() + start + reservedSize);
+    }
+
+    writeLength(&mBuffer[start], length, lengthSize);
+
+    return *this;
+}
+
+const std::vector<uint8_t>& BerTlvWriter::getBytes() const
+{
+    if (mDepth != 0) {
+        throw IllegalStateException("Constructed TLV not closed.");
+    }
+
+    return mBuffer;
+}
+
+size_t BerTlvWriter::size() const
+{
+    return mBuffer.size();
+}
+
+void BerTlvWriter::reset()
+{
+    mBuffer.clear();
+    mDepth = 0;
+}
+
+void BerTlvWriter::writeTag(const int tag)
+{
+    const uint32_t value = static_cast<uint32_t>(tag);
+
+    if (value > 0xFFFFFF) {
+        mBuffer.push_back(static_cast<uint8_t>(value >> 24));
+    }
+    if (value > 0xFFFF) {
+        mBuffer.push_back(static_cast<uint8_t>(value >> 16));
+    }
+    if (value > 0xFF) {
+        mBuffer.push_back(static_cast<uint8_t>(value >> 8));
+    }
+    mBuffer.push_back(static_cast<uint8_t>(value));
+}
+
+size_t BerTlvWriter::getLengthSize(const size_t length)
+{
+    if (length < 0x80) {
+        return 1;
+    } else if (length <= 0xFF) {
+        return 2;
+    } else if (length <= 0xFFFF) {
+        return 3;
+    } else if (length <= 0xFFFFFF) {
+        return 4;
+    } else if (static_cast<uint64_t>(length) <= 0xFFFFFFFF) {
+        return 5;
+    }
+
+    throw IllegalArgumentException("TLV value too long.");
+}
+
+void BerTlvWriter::writeLength(uint8_t* dest, const size_t length, const size_t lengthSize)
+{
+    if (lengthSize == 1) {
+        dest[0] = static_cast<uint8_t>(length);
+        return;
+    }
+
+    dest[0] = static_cast<uint8_t>(0x80 | (lengthSize - 1));
+    for (size_t i = 1; i < lengthSize; i++) {
+        dest[i] = static_cast<uint8_t>(length >> (8 * (lengthSize - 1 - i)));
+    }
+}
+
+}
+}
+}
@@ -0,0 +1,195 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Encoder of BER-TLV structures (e.g. PUT DATA or STORE DATA payloads).
+ *
+ * <p>The TLVs are written in a single pass into one buffer, constructed TLVs being opened and
+ * closed around their children:
+ *
+ * <pre>
+ * BerTlvWriter writer;
+ * writer.startConstructed(0x6F).add(0x84, aid).startConstructed(0xA5).add(0x88, sfi)
+ *       .endConstructed().endConstructed();
+ * </pre>
+ *
+ * <p>The length of a constructed TLV is back-patched when it is closed, using the shortest
+ * definite form (1 to 5 bytes). Tags are written on as many bytes as their significant bytes (1 to
+ * 4).
+ *
+ * <p>A single byte is reserved for the length of a constructed TLV opened without size hint: if
+ * its value turns out to need the long form (128 bytes or more), the value is shifted when the TLV
+ * is closed, each level of nesting shifting it again. Providing the expected size of the value to
+ * {@link #startConstructed(const int, const size_t)} reserves the right length width up front, so
+ * that large nested structures are written in a single pass.
+ *
+ * <p>The buffer is kept by {@link #reset()}, so that a writer can be reused without reallocation.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BerTlvWriter final {
+public:
+    /**
+     * Maximum nesting level of constructed TLVs.
+     *
+     * @since 2.4.0
+     */
+    static const int MAX_DEPTH = 32;
+
+    /**
+     * Creates a writer.
+     *
+     * @param capacity The initial capacity of the buffer, in bytes.
+     * @since 2.4.0
+     */
+    explicit BerTlvWriter(const size_t capacity = 256);
+
+    /**
+     * Adds a TLV whose value is known.
+     *
+     * @param tag The tag ID (e.g. 0x84).
+     * @param value The value, which may be located in the buffer of the writer (e.g. a TLV
+     *        already written and repeated).
+     * @param length The length of the value.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    BerTlvWriter& add(const int tag, const uint8_t* value, const size_t length);
+
+    /**
+     * Adds a TLV whose value is known.
+     *
+     * @param tag The tag ID (e.g. 0x84).
+     * @param value The value.
+     * @return The current instance.
+     * @since 2.4.0
+     */
+    BerTlvWriter& add(const int tag, const std::vector<uint8_t>& value);
+
+    /**
+     * Opens a constructed TLV, the following TLVs being its children until {@link
+     * #endConstructed()} is called.
+     *
+     * @param tag The tag ID (e.g. 0xA5).
+     * @return The current instance.
+     * @throw IllegalArgumentException If the tag is not constructed.
+     * @throw IllegalStateException If too many constructed TLVs are open.
+     * @since 2.4.0
+     */
+    BerTlvWriter& startConstructed(const int tag);
+
+    /**
+     * Opens a constructed TLV whose value size is expected, the following TLVs being its children
+     * until {@link #endConstructed()} is called.
+     *
+     * <p>The length field is reserved with the width needed by the expected size, so that the
+     * value is not shifted when the TLV is closed. A wrong hint only costs that shift, the length
+     * always being encoded in the shortest form.
+     *
+     * @param tag The tag ID (e.g. 0xA5).
+     * @param sizeHint The expected size of the value.
+     * @return The current instance.
+     * @throw IllegalArgumentException If the tag is not constructed or the hint is too large.
+     * @throw IllegalStateException If too many constructed TLVs are open.
+     * @since 2.4.0
+     */
+    BerTlvWriter& startConstructed(const int tag, const size_t sizeHint);
+
+    /**
+     * Closes the last constructed TLV opened and writes its length.
+     *
+     * @return The current instance.
+     * @throw IllegalStateException If no constructed TLV is open.
+     * @since 2.4.0
+     */
+    BerTlvWriter& endConstructed();
+
+    /**
+     * Gets the encoded structure.
+     *
+     * @return A reference to the buffer of the writer, valid until the next modification.
+     * @throw IllegalStateException If a constructed TLV is still open.
+     * @since 2.4.0
+     */
+    const std::vector<uint8_t>& getBytes() const;
+
+    /**
+     * Gets the number of bytes written so far.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    size_t size() const;
+
+    /**
+     * Discards the TLVs written so far, keeping the buffer capacity.
+     *
+     * @since 2.4.0
+     */
+    void reset();
+
+private:
+    /**
+     *
+     */
+    std::vector<uint8_t> mBuffer;
+
+    /**
+     * Number of open constructed TLVs
+     */
+    int mDepth;
+
+    /**
+     * Offsets of the length placeholders of the open constructed TLVs
+     */
+    size_t mStarts[MAX_DEPTH];
+
+    /**
+     * Sizes of the length placeholders of the open constructed TLVs
+     */
+    size_t mLengthSizes[MAX_DEPTH];
+
+    /**
+     * (private)<br>
+     * Appends the significant bytes of the tag.
+     */
+    void writeTag(const int tag);
+
+    /**
+     * (private)<br>
+     * Gets the size of the length field encoding the provided length.
+     */
+    static size_t getLengthSize(const size_t length);
+
+    /**
+     * (private)<br>
+     * Encodes the length field at the provided location, large enough for it.
+     */
+    static void writeLength(uint8_t* dest, const size_t length, const size_t lengthSize);
+};
+
+}
+}
+}
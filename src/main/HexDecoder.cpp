@@ -0,0 +1,116 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "HexDecoder.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+HexDecoder::HexDecoder(const Sink& sink)
+: mSink(sink), mOffset(0), mPending(0), mHasPending(false) {}
+
+HexDecoder::HexDecoder(std::ostream& os)
+: mSink([&os](const uint8_t* data, const size_t length) {
+      os.write(reinterpret_cast<const char*>(data), static_cast<std::streamsize>(length));
+  }),
+  mOffset(0),
+  mPending(0),
+  mHasPending(false) {}
+
+void HexDecoder::update(const char* hex, const size_t length)
+{
+    size_t offset = 0;
+
+    if (mHasPending && length != 0) {
+        /* Completes the byte started by the previous chunk */
+        const char pair[2] = {mPending, hex[0]};
+        const size_t error = HexUtil::decode(pair, 2, mBuffer);
+
+        if (error != HexUtil::npos) {
+            throwInvalidCharacter(mOffset - 1 + error);
+        }
+
+        mSink(mBuffer, 1);
+        mHasPending = false;
+        mOffset++;
+        offset = 1;
+    }
+
+    while (length - offset >= 2) {
+        size_t chunk = (length - offset) & ~static_cast<size_t>(1);
+        if (chunk > 2 * BUFFER_SIZE) {
+            chunk = 2 * BUFFER_SIZE;
+        }
+
+        const size_t error = HexUtil::decode(hex + offset, chunk, mBuffer);
+
+        if (error != HexUtil::npos) {
+            throwInvalidCharacter(mOffset + error);
+        }
+
+        mSink(mBuffer, chunk / 2);
+        mOffset += chunk;
+        offset += chunk;
+    }
+
+    if (offset < length) {
+        /* Odd number of characters, the last one is checked along with the next chunk */
+        mPending = hex[offset];
+        mHasPending = true;
+        mOffset++;
+    }
+}
+
+void HexDecoder::update(const std::string& hex)
+{
+    update(hex.data(), hex.length());
+}
+
+void HexDecoder::finish()
+{
+    const bool hasPending = mHasPending;
+
+    reset();
+
+    if (hasPending) {
+        throw IllegalArgumentException("Odd number of hexadecimal characters.");
+    }
+}
+
+void HexDecoder::reset()
+{
+    mOffset = 0;
+    mPending = 0;
+    mHasPending = false;
+}
+
+uint64_t HexDecoder::getLength() const
+{
+    return mOffset / 2;
+}
+
+void HexDecoder::throwInvalidCharacter(const uint64_t offset) const
+{
+    throw IllegalArgumentException("Invalid hexadecimal character at offset " +
+                                   std::to_string(offset) + ".");
+}
+
+}
+}
+}
@@ -0,0 +1,150 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Incremental hexadecimal string to byte array converter.
+ *
+ * <p>Characters are provided in chunks of any size, a chunk may end in the middle of a byte (odd
+ * number of characters), the pending digit being combined with the first character of the next
+ * chunk. Bytes are converted through a fixed size internal buffer and pushed to a sink (callback or
+ * output stream) as they are produced, memory use is therefore constant whatever the total size of
+ * the data.
+ *
+ * <p>Unlike {@link HexUtil#toByteArray(const std::string&)}, every character is checked.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API HexDecoder final {
+public:
+    /**
+     * Receives the bytes produced by the decoder.
+     *
+     * @since 2.4.0
+     */
+    typedef std::function<void(const uint8_t* data, const size_t length)> Sink;
+
+    /**
+     * Creates a decoder pushing the bytes to a callback.
+     *
+     * @param sink The callback, invoked with at most 4096 bytes at a time.
+     * @since 2.4.0
+     */
+    explicit HexDecoder(const Sink& sink);
+
+    /**
+     * Creates a decoder writing the bytes to an output stream.
+     *
+     * @param os The output stream, must outlive the decoder.
+     * @since 2.4.0
+     */
+    explicit HexDecoder(std::ostream& os);
+
+    /**
+     * Converts a chunk of hexadecimal characters.
+     *
+     * @param hex The characters to convert.
+     * @param length The number of characters.
+     * @throw IllegalArgumentException If a character is not an hexadecimal digit. The message
+     *        gives its offset from the beginning of the stream; the state of the decoder is then
+     *        unspecified until {@link #reset()} is called.
+     * @since 2.4.0
+     */
+    void update(const char* hex, const size_t length);
+
+    /**
+     * Converts a chunk of hexadecimal characters.
+     *
+     * @param hex The characters to convert.
+     * @throw IllegalArgumentException If a character is not an hexadecimal digit.
+     * @since 2.4.0
+     */
+    void update(const std::string& hex);
+
+    /**
+     * Indicates the end of the stream and makes the decoder ready for a new one.
+     *
+     * @throw IllegalArgumentException If the stream was made of an odd number of characters.
+     * @since 2.4.0
+     */
+    void finish();
+
+    /**
+     * Discards any pending digit and makes the decoder ready for a new stream.
+     *
+     * @since 2.4.0
+     */
+    void reset();
+
+    /**
+     * Gets the number of bytes produced so far for the current stream.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    uint64_t getLength() const;
+
+private:
+    /**
+     * Size of the internal buffer, in bytes
+     */
+    static const size_t BUFFER_SIZE = 4096;
+
+    /**
+     *
+     */
+    const Sink mSink;
+
+    /**
+     * Number of characters consumed for the current stream
+     */
+    uint64_t mOffset;
+
+    /**
+     * Pending digit (high nibble) of a byte split across two chunks
+     */
+    char mPending;
+
+    /**
+     *
+     */
+    bool mHasPending;
+
+    /**
+     *
+     */
+    uint8_t mBuffer[BUFFER_SIZE];
+
+    /**
+     * (private)<br>
+     * Throws the exception reporting an invalid character.
+     */
+    void throwInvalidCharacter(const uint64_t offset) const;
+};
+
+}
+}
+}
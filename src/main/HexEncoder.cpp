@@ -0,0 +1,60 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "HexEncoder.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+HexEncoder::HexEncoder(const Sink& sink) : mSink(sink), mLength(0) {}
+
+HexEncoder::HexEncoder(std::ostream& os)
+: mSink([&os](const char* hex, const size_t length) {
+      os.write(hex, static_cast<std::streamsize>(length));
+  }),
+  mLength(0) {}
+
+void HexEncoder::update(const uint8_t* src, const size_t length)
+{
+    size_t offset = 0;
+
+    while (offset < length) {
+        size_t chunk = length - offset;
+        if (chunk > BUFFER_SIZE / 2) {
+            chunk = BUFFER_SIZE / 2;
+        }
+
+        const size_t hexLength = HexUtil::toHex(src + offset, chunk, mBuffer);
+        mSink(mBuffer, hexLength);
+
+        offset += chunk;
+        mLength += hexLength;
+    }
+}
+
+void HexEncoder::update(const std::vector<uint8_t>& src)
+{
+    update(src.data(), src.size());
+}
+
+uint64_t HexEncoder::getLength() const
+{
+    return mLength;
+}
+
+}
+}
+}
@@ -0,0 +1,115 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Incremental byte array to hexadecimal string converter.
+ *
+ * <p>Bytes are provided in chunks of any size and converted through a fixed size internal buffer,
+ * the hexadecimal characters being pushed to a sink (callback or output stream) as they are
+ * produced. Memory use is therefore constant whatever the total size of the data (e.g. card memory
+ * dumps).
+ *
+ * <p>The produced characters are the same as the ones of {@link HexUtil#toHex(const
+ * std::vector<uint8_t>&)} applied to the concatenation of the chunks.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API HexEncoder final {
+public:
+    /**
+     * Receives the hexadecimal characters produced by the encoder.
+     *
+     * @since 2.4.0
+     */
+    typedef std::function<void(const char* hex, const size_t length)> Sink;
+
+    /**
+     * Creates an encoder pushing the characters to a callback.
+     *
+     * @param sink The callback, invoked with at most 4096 characters at a time.
+     * @since 2.4.0
+     */
+    explicit HexEncoder(const Sink& sink);
+
+    /**
+     * Creates an encoder writing the characters to an output stream.
+     *
+     * @param os The output stream, must outlive the encoder.
+     * @since 2.4.0
+     */
+    explicit HexEncoder(std::ostream& os);
+
+    /**
+     * Converts a chunk of bytes.
+     *
+     * @param src The bytes to convert.
+     * @param length The number of bytes.
+     * @since 2.4.0
+     */
+    void update(const uint8_t* src, const size_t length);
+
+    /**
+     * Converts a chunk of bytes.
+     *
+     * @param src The bytes to convert.
+     * @since 2.4.0
+     */
+    void update(const std::vector<uint8_t>& src);
+
+    /**
+     * Gets the number of characters produced so far.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    uint64_t getLength() const;
+
+private:
+    /**
+     * Size of the internal buffer, in characters
+     */
+    static const size_t BUFFER_SIZE = 4096;
+
+    /**
+     *
+     */
+    const Sink mSink;
+
+    /**
+     *
+     */
+    uint64_t mLength;
+
+    /**
+     *
+     */
+    char mBuffer[BUFFER_SIZE];
+};
+
+}
+}
+}
@@ -0,0 +1,126 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/* Keyple Core Util */
+#include "IllegalArgumentException.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+using namespace keyple::core::util::cpp::exception;
+
+/**
+ * Compile-time conversion of hexadecimal string literals to byte arrays.
+ *
+ * <p>Constant APDU commands and templates can be declared without any parsing at startup and
+ * placed in read-only memory:
+ *
+ * <pre>
+ * static constexpr std::array<uint8_t, 5> SELECT_HEADER = HexLiteral::toByteArray("00A4040007");
+ * </pre>
+ *
+ * <p>An odd number of characters is rejected by a static assertion. A character that is not an
+ * hexadecimal digit makes the expression non constant, which is reported by the compiler when the
+ * result initializes a constexpr variable (or throws an IllegalArgumentException when evaluated at
+ * runtime).
+ *
+ * @since 2.4.0
+ */
+class HexLiteral final {
+public:
+    /**
+     * Converts an hexadecimal string literal to a byte array.
+     *
+     * @param hex The hexadecimal string literal (upper or lower case digits).
+     * @return An array of (number of characters / 2) bytes.
+     * @throw IllegalArgumentException If a character is not an hexadecimal digit (runtime
+     *        evaluation only).
+     * @since 2.4.0
+     */
+    template <size_t N>
+    static constexpr std::array<uint8_t, (N - 1) / 2> toByteArray(const char (&hex)[N])
+    {
+        static_assert((N - 1) % 2 == 0, "Hex literal must have an even number of digits.");
+
+        return toByteArray(hex, typename MakeIndexSequence<(N - 1) / 2>::type());
+    }
+
+private:
+    /**
+     * (private)<br>
+     * C++11 substitute of std::index_sequence.
+     */
+    template <size_t... I>
+    struct IndexSequence {};
+
+    template <size_t N, size_t... I>
+    struct MakeIndexSequence : MakeIndexSequence<N - 1, N - 1, I...> {};
+
+    template <size_t... I>
+    struct MakeIndexSequence<0, I...> {
+        typedef IndexSequence<I...> type;
+    };
+
+    /**
+     * (private)<br>
+     * Not constexpr on purpose: reaching it during a constant evaluation is a compilation error.
+     */
+    static uint8_t invalidDigit()
+    {
+        throw IllegalArgumentException("Invalid hexadecimal digit.");
+    }
+
+    /**
+     * (private)
+     */
+    static constexpr uint8_t toNibble(const char c)
+    {
+        return c >= '0' && c <= '9' ? static_cast<uint8_t>(c - '0') :
+               c >= 'A' && c <= 'F' ? static_cast<uint8_t>(c - 'A' + 10) :
+               c >= 'a' && c <= 'f' ? static_cast<uint8_t>(c - 'a' + 10) :
+                                      invalidDigit();
+    }
+
+    /**
+     * (private)
+     */
+    static constexpr uint8_t toByte(const char* hex, const size_t index)
+    {
+        return static_cast<uint8_t>((toNibble(hex[2 * index]) << 4) | toNibble(hex[2 * index + 1]));
+    }
+
+    /**
+     * (private)
+     */
+    template <size_t N, size_t... I>
+    static constexpr std::array<uint8_t, sizeof...(I)> toByteArray(const char (&hex)[N],
+                                                                   IndexSequence<I...>)
+    {
+        return {{toByte(hex, I)...}};
+    }
+
+    /**
+     * (private)
+     */
+    HexLiteral();
+};
+
+}
+}
+}
@@ -12,7 +12,30 @@
 
 #include "HexUtil.h"
 
-#include <sstream>
+#include <cstring>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define KEYPLEUTIL_HEX_X86
+#include <immintrin.h>
+/* GCC < 4.9 only exposes the AVX2 intrinsics when the whole unit is built with -mavx2 */
+#if defined(__AVX2__) || defined(__clang__) || defined(_MSC_VER) || \
+    (defined(__GNUC__) && (__GNUC__ > 4 || (__GNUC__ == 4 && __GNUC_MINOR__ >= 9)))
+#define KEYPLEUTIL_HEX_AVX2
+#endif
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define KEYPLEUTIL_HEX_NEON
+#include <arm_neon.h>
+#endif
+
+#if defined(__GNUC__)
+#define KEYPLEUTIL_TARGET(x) __attribute__((target(x)))
+#else
+#define KEYPLEUTIL_TARGET(x)
+#endif
 
 /* Keyple Core Util */
 #include "StringIndexOutOfBoundsException.h"
@@ -23,26 +46,31 @@ namespace util {
 
 using namespace keyple::core::util::cpp::exception;
 
-const std::vector<std::string> HexUtil::mByteToHex = {
-    "00", "01", "02", "03", "04", "05", "06", "07", "08", "09", "0A", "0B", "0C", "0D", "0E", "0F",
-    "10", "11", "12", "13", "14", "15", "16", "17", "18", "19", "1A", "1B", "1C", "1D", "1E", "1F",
-    "20", "21", "22", "23", "24", "25", "26", "27", "28", "29", "2A", "2B", "2C", "2D", "2E", "2F",
-    "30", "31", "32", "33", "34", "35", "36", "37", "38", "39", "3A", "3B", "3C", "3D", "3E", "3F",
-    "40", "41", "42", "43", "44", "45", "46", "47", "48", "49", "4A", "4B", "4C", "4D", "4E", "4F",
-    "50", "51", "52", "53", "54", "55", "56", "57", "58", "59", "5A", "5B", "5C", "5D", "5E", "5F",
-    "60", "61", "62", "63", "64", "65", "66", "67", "68", "69", "6A", "6B", "6C", "6D", "6E", "6F",
-    "70", "71", "72", "73", "74", "75", "76", "77", "78", "79", "7A", "7B", "7C", "7D", "7E", "7F",
-    "80", "81", "82", "83", "84", "85", "86", "87", "88", "89", "8A", "8B", "8C", "8D", "8E", "8F",
-    "90", "91", "92", "93", "94", "95", "96", "97", "98", "99", "9A", "9B", "9C", "9D", "9E", "9F",
-    "A0", "A1", "A2", "A3", "A4", "A5", "A6", "A7", "A8", "A9", "AA", "AB", "AC", "AD", "AE", "AF",
-    "B0", "B1", "B2", "B3", "B4", "B5", "B6", "B7", "B8", "B9", "BA", "BB", "BC", "BD", "BE", "BF",
-    "C0", "C1", "C2", "C3", "C4", "C5", "C6", "C7", "C8", "C9", "CA", "CB", "CC", "CD", "CE", "CF",
-    "D0", "D1", "D2", "D3", "D4", "D5", "D6", "D7", "D8", "D9", "DA", "DB", "DC", "DD", "DE", "DF",
-    "E0", "E1", "E2", "E3", "E4", "E5", "E6", "E7", "E8", "E9", "EA", "EB", "EC", "ED", "EE", "EF",
-    "F0", "F1", "F2", "F3", "F4", "F5", "F6", "F7", "F8", "F9", "FA", "FB", "FC", "FD", "FE", "FF"
-};
-
-const std::vector<uint8_t> HexUtil::mHexToNibble = {
+/**
+ * Byte to hex digits pair conversion table
+ */
+static const char BYTE_TO_HEX[] =
+    "000102030405060708090A0B0C0D0E0F"
+    "101112131415161718191A1B1C1D1E1F"
+    "202122232425262728292A2B2C2D2E2F"
+    "303132333435363738393A3B3C3D3E3F"
+    "404142434445464748494A4B4C4D4E4F"
+    "505152535455565758595A5B5C5D5E5F"
+    "606162636465666768696A6B6C6D6E6F"
+    "707172737475767778797A7B7C7D7E7F"
+    "808182838485868788898A8B8C8D8E8F"
+    "909192939495969798999A9B9C9D9E9F"
+    "A0A1A2A3A4A5A6A7A8A9AAABACADAEAF"
+    "B0B1B2B3B4B5B6B7B8B9BABBBCBDBEBF"
+    "C0C1C2C3C4C5C6C7C8C9CACBCCCDCECF"
+    "D0D1D2D3D4D5D6D7D8D9DADBDCDDDEDF"
+    "E0E1E2E3E4E5E6E7E8E9EAEBECEDEEEF"
+    "F0F1F2F3F4F5F6F7F8F9FAFBFCFDFEFF";
+
+/**
+ * Hex digit to nibble conversion table (0xFF for characters that are not hex digits)
+ */
+static const uint8_t HEX_TO_NIBBLE[256] = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
@@ -61,82 +89,581 @@ const std::vector<uint8_t> HexUtil::mHexToNibble = {
     0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
 };
 
-HexUtil::HexUtil() {}
+/**
+ * Signature of the byte array to hex string conversion kernels.
+ */
+typedef void (*EncodeKernel)(const uint8_t* src, const size_t length, char* dest);
 
-bool HexUtil::isValid(const std::string& hex)
+static void encodeScalar(const uint8_t* src, const size_t length, char* dest)
+{
+    for (size_t i = 0; i < length; i++) {
+        std::memcpy(dest + 2 * i, BYTE_TO_HEX + 2 * src[i], 2);
+    }
+}
+
+#if defined(KEYPLEUTIL_HEX_X86)
+KEYPLEUTIL_TARGET("sse2")
+static inline __m128i nibblesToHexSse2(const __m128i nibbles)
 {
-    if (hex.length() == 0 || hex.length() % 2 != 0) {
+    /* '0' + n, plus ('A' - '0' - 10) when n > 9 */
+    const __m128i letters = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)),
+                                          _mm_set1_epi8('A' - '0' - 10));
+
+    return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letters);
+}
+
+KEYPLEUTIL_TARGET("sse2")
+static void encodeSse2(const uint8_t* src, const size_t length, char* dest)
+{
+    const __m128i mask = _mm_set1_epi8(0x0F);
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i));
+        const __m128i hi = nibblesToHexSse2(_mm_and_si128(_mm_srli_epi16(in, 4), mask));
+        const __m128i lo = nibblesToHexSse2(_mm_and_si128(in, mask));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 2 * i), _mm_unpacklo_epi8(hi, lo));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + 2 * i + 16),
+                         _mm_unpackhi_epi8(hi, lo));
+    }
+
+    encodeScalar(src + i, length - i, dest + 2 * i);
+}
+
+#if defined(KEYPLEUTIL_HEX_AVX2)
+KEYPLEUTIL_TARGET("avx2")
+static inline __m256i nibblesToHexAvx2(const __m256i nibbles)
+{
+    const __m256i letters = _mm256_and_si256(_mm256_cmpgt_epi8(nibbles, _mm256_set1_epi8(9)),
+                                             _mm256_set1_epi8('A' - '0' - 10));
+
+    return _mm256_add_epi8(_mm256_add_epi8(nibbles, _mm256_set1_epi8('0')), letters);
+}
+
+KEYPLEUTIL_TARGET("avx2")
+static void encodeAvx2(const uint8_t* src, const size_t length, char* dest)
+{
+    const __m256i mask = _mm256_set1_epi8(0x0F);
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        const __m256i in = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src + i));
+        const __m256i hi = nibblesToHexAvx2(_mm256_and_si256(_mm256_srli_epi16(in, 4), mask));
+        const __m256i lo = nibblesToHexAvx2(_mm256_and_si256(in, mask));
+
+        /* Unpacking works per 128-bit lane, lanes are put back in order afterwards */
+        const __m256i first = _mm256_unpacklo_epi8(hi, lo);
+        const __m256i second = _mm256_unpackhi_epi8(hi, lo);
+
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i),
+                            _mm256_permute2x128_si256(first, second, 0x20));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + 2 * i + 32),
+                            _mm256_permute2x128_si256(first, second, 0x31));
+    }
+
+    encodeSse2(src + i, length - i, dest + 2 * i);
+}
+#endif
+
+static bool isSse2Supported()
+{
+#if defined(__x86_64__) || defined(_M_X64) || defined(__SSE2__)
+    return true;
+#elif defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 1);
+    return (regs[3] & (1 << 26)) != 0;
+#else
+    return __builtin_cpu_supports("sse2");
+#endif
+}
+
+#if defined(KEYPLEUTIL_HEX_AVX2)
+static bool isAvx2Supported()
+{
+#if defined(_MSC_VER)
+    int regs[4];
+    __cpuid(regs, 0);
+    if (regs[0] < 7) {
         return false;
     }
 
-    for (int i = 0; i < static_cast<int>(hex.size()); i++) {
-        if (mHexToNibble[hex.at(i)] == 0xFF) {
-            return false;
+    /* OSXSAVE and AVX, then YMM state enabled by the OS */
+    __cpuid(regs, 1);
+    if ((regs[2] & (1 << 27)) == 0 || (regs[2] & (1 << 28)) == 0 || (_xgetbv(0) & 0x6) != 0x6) {
+        return false;
+    }
+
+    __cpuidex(regs, 7, 0);
+    return (regs[1] & (1 << 5)) != 0;
+#else
+    return __builtin_cpu_supports("avx2");
+#endif
+}
+#endif
+#endif
+
+#if defined(KEYPLEUTIL_HEX_NEON)
+static inline uint8x16_t nibblesToHexNeon(const uint8x16_t nibbles)
+{
+    const uint8x16_t letters = vandq_u8(vcgtq_u8(nibbles, vdupq_n_u8(9)),
+                                        vdupq_n_u8('A' - '0' - 10));
+
+    return vaddq_u8(vaddq_u8(nibbles, vdupq_n_u8('0')), letters);
+}
+
+static void encodeNeon(const uint8_t* src, const size_t length, char* dest)
+{
+    size_t i = 0;
+
+    for (; i + 16 <= length; i += 16) {
+        const uint8x16_t in = vld1q_u8(src + i);
+        uint8x16x2_t out;
+
+        out.val[0] = nibblesToHexNeon(vshrq_n_u8(in, 4));
+        out.val[1] = nibblesToHexNeon(vandq_u8(in, vdupq_n_u8(0x0F)));
+
+        /* Interleaving store: high nibble digit first */
+        vst2q_u8(reinterpret_cast<uint8_t*>(dest + 2 * i), out);
+    }
+
+    encodeScalar(src + i, length - i, dest + 2 * i);
+}
+#endif
+
+/**
+ * Signature of the hex string to byte array conversion kernels.
+ *
+ * <p>A kernel validates and converts an even number of characters. When dest is null, the
+ * characters are only validated. The returned value is HexUtil::npos if all the characters are hex
+ * digits, otherwise the offset of the first invalid one; in that case, all the bytes preceding the
+ * faulty one have been written.
+ */
+typedef size_t (*DecodeKernel)(const char* hex, const size_t length, uint8_t* dest);
+
+static size_t decodeScalar(const char* hex, const size_t length, uint8_t* dest)
+{
+    for (size_t i = 0; i < length; i += 2) {
+        const uint8_t hi = HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])];
+        const uint8_t lo = HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i + 1])];
+
+        if (((hi | lo) & 0xF0) != 0) {
+            return hi == 0xFF ? i : i + 1;
+        }
+
+        if (dest != nullptr) {
+            dest[i / 2] = static_cast<uint8_t>((hi << 4) | lo);
         }
     }
 
-    return true;
+    return HexUtil::npos;
 }
 
-const std::vector<uint8_t> HexUtil::toByteArray(const std::string& hex)
+#if defined(KEYPLEUTIL_HEX_X86)
+KEYPLEUTIL_TARGET("sse2")
+static inline __m128i hexToNibblesSse2(const __m128i chars, __m128i& valid)
 {
-    std::vector<uint8_t> tab(hex.size() / 2);
+    const __m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+    const __m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)),
+                                         _mm_set1_epi8('a'));
+
+    /* Unsigned range checks: x <= max is equivalent to min(x, max) == x */
+    const __m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+    const __m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+
+    valid = _mm_or_si128(isDigit, isLetter);
 
+    return _mm_or_si128(_mm_and_si128(isDigit, digits),
+                        _mm_and_si128(isLetter, _mm_add_epi8(letters, _mm_set1_epi8(10))));
+}
+
+KEYPLEUTIL_TARGET("sse2")
+static inline __m128i packNibblesSse2(const __m128i nibbles)
+{
+    /* Each 16-bit lane holds the high nibble in its low byte and the low nibble in its high byte */
+    return _mm_or_si128(_mm_and_si128(_mm_slli_epi16(nibbles, 4), _mm_set1_epi16(0x00F0)),
+                        _mm_srli_epi16(nibbles, 8));
+}
+
+KEYPLEUTIL_TARGET("sse2")
+static size_t decodeSse2(const char* hex, const size_t length, uint8_t* dest)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        __m128i valid1;
+        __m128i valid2;
+        const __m128i nibbles1 = hexToNibblesSse2(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + i)), valid1);
+        const __m128i nibbles2 = hexToNibblesSse2(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + i + 16)), valid2);
+
+        if (_mm_movemask_epi8(_mm_and_si128(valid1, valid2)) != 0xFFFF) {
+            /* The scalar kernel locates the first invalid character of the block */
+            break;
+        }
+
+        if (dest != nullptr) {
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dest + i / 2),
+                             _mm_packus_epi16(packNibblesSse2(nibbles1),
+                                              packNibblesSse2(nibbles2)));
+        }
+    }
+
+    const size_t offset =
+        decodeScalar(hex + i, length - i, dest != nullptr ? dest + i / 2 : nullptr);
+
+    return offset == HexUtil::npos ? offset : i + offset;
+}
+
+#if defined(KEYPLEUTIL_HEX_AVX2)
+KEYPLEUTIL_TARGET("avx2")
+static inline __m256i hexToNibblesAvx2(const __m256i chars, __m256i& valid)
+{
+    const __m256i digits = _mm256_sub_epi8(chars, _mm256_set1_epi8('0'));
+    const __m256i letters = _mm256_sub_epi8(_mm256_or_si256(chars, _mm256_set1_epi8(0x20)),
+                                            _mm256_set1_epi8('a'));
+    const __m256i isDigit =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(digits, _mm256_set1_epi8(9)), digits);
+    const __m256i isLetter =
+        _mm256_cmpeq_epi8(_mm256_min_epu8(letters, _mm256_set1_epi8(5)), letters);
+
+    valid = _mm256_or_si256(isDigit, isLetter);
+
+    return _mm256_or_si256(_mm256_and_si256(isDigit, digits),
+                           _mm256_and_si256(isLetter,
+                                            _mm256_add_epi8(letters, _mm256_set1_epi8(10))));
+}
+
+KEYPLEUTIL_TARGET("avx2")
+static inline __m256i packNibblesAvx2(const __m256i nibbles)
+{
+    return _mm256_or_si256(
+        _mm256_and_si256(_mm256_slli_epi16(nibbles, 4), _mm256_set1_epi16(0x00F0)),
+        _mm256_srli_epi16(nibbles, 8));
+}
+
+KEYPLEUTIL_TARGET("avx2")
+static size_t decodeAvx2(const char* hex, const size_t length, uint8_t* dest)
+{
+    size_t i = 0;
+
+    for (; i + 64 <= length; i += 64) {
+        __m256i valid1;
+        __m256i valid2;
+        const __m256i nibbles1 = hexToNibblesAvx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + i)), valid1);
+        const __m256i nibbles2 = hexToNibblesAvx2(
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex + i + 32)), valid2);
+
+        if (_mm256_movemask_epi8(_mm256_and_si256(valid1, valid2)) != -1) {
+            break;
+        }
+
+        if (dest != nullptr) {
+            /* Packing works per 128-bit lane, 64-bit blocks are put back in order afterwards */
+            const __m256i bytes = _mm256_packus_epi16(packNibblesAvx2(nibbles1),
+                                                      packNibblesAvx2(nibbles2));
+
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest + i / 2),
+                                _mm256_permute4x64_epi64(bytes, 0xD8));
+        }
+    }
+
+    const size_t offset =
+        decodeSse2(hex + i, length - i, dest != nullptr ? dest + i / 2 : nullptr);
+
+    return offset == HexUtil::npos ? offset : i + offset;
+}
+#endif
+#endif
+
+#if defined(KEYPLEUTIL_HEX_NEON)
+static inline uint8x16_t hexToNibblesNeon(const uint8x16_t chars, uint8x16_t& valid)
+{
+    const uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('0'));
+    const uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+    const uint8x16_t isDigit = vcleq_u8(digits, vdupq_n_u8(9));
+    const uint8x16_t isLetter = vcleq_u8(letters, vdupq_n_u8(5));
+
+    valid = vorrq_u8(isDigit, isLetter);
+
+    return vorrq_u8(vandq_u8(isDigit, digits),
+                    vandq_u8(isLetter, vaddq_u8(letters, vdupq_n_u8(10))));
+}
+
+static size_t decodeNeon(const char* hex, const size_t length, uint8_t* dest)
+{
+    size_t i = 0;
+
+    for (; i + 32 <= length; i += 32) {
+        /* De-interleaving load: even characters (high nibbles) then odd ones (low nibbles) */
+        const uint8x16x2_t chars = vld2q_u8(reinterpret_cast<const uint8_t*>(hex + i));
+        uint8x16_t validHi;
+        uint8x16_t validLo;
+        const uint8x16_t hi = hexToNibblesNeon(chars.val[0], validHi);
+        const uint8x16_t lo = hexToNibblesNeon(chars.val[1], validLo);
+        const uint64x2_t valid = vreinterpretq_u64_u8(vandq_u8(validHi, validLo));
+
+        if ((vgetq_lane_u64(valid, 0) & vgetq_lane_u64(valid, 1)) != UINT64_MAX) {
+            break;
+        }
+
+        if (dest != nullptr) {
+            vst1q_u8(dest + i / 2, vorrq_u8(vshlq_n_u8(hi, 4), lo));
+        }
+    }
+
+    const size_t offset =
+        decodeScalar(hex + i, length - i, dest != nullptr ? dest + i / 2 : nullptr);
+
+    return offset == HexUtil::npos ? offset : i + offset;
+}
+#endif
+
+/**
+ * Selects, once, the fastest conversion kernel supported by the running CPU.
+ */
+static EncodeKernel selectEncodeKernel()
+{
+#if defined(KEYPLEUTIL_HEX_X86)
+#if defined(KEYPLEUTIL_HEX_AVX2)
+    if (isAvx2Supported()) {
+        return encodeAvx2;
+    }
+#endif
+    if (isSse2Supported()) {
+        return encodeSse2;
+    }
+#elif defined(KEYPLEUTIL_HEX_NEON)
+    return encodeNeon;
+#endif
+
+    return encodeScalar;
+}
+
+static void encodeHex(const uint8_t* src, const size_t length, char* dest)
+{
+    static const EncodeKernel kernel = selectEncodeKernel();
+
+    kernel(src, length, dest);
+}
+
+/**
+ * Selects, once, the fastest validation and conversion kernel supported by the running CPU.
+ */
+static DecodeKernel selectDecodeKernel()
+{
+#if defined(KEYPLEUTIL_HEX_X86)
+#if defined(KEYPLEUTIL_HEX_AVX2)
+    if (isAvx2Supported()) {
+        return decodeAvx2;
+    }
+#endif
+    if (isSse2Supported()) {
+        return decodeSse2;
+    }
+#elif defined(KEYPLEUTIL_HEX_NEON)
+    return decodeNeon;
+#endif
+
+    return decodeScalar;
+}
+
+static size_t decodeHex(const char* hex, const size_t length, uint8_t* dest)
+{
+    static const DecodeKernel kernel = selectDecodeKernel();
+
+    return kernel(hex, length, dest);
+}
+
+/**
+ * Returns the number of zero bits preceding the highest one bit of a non zero value.
+ */
+static inline int numberOfLeadingZeros(const uint64_t val)
+{
+#if defined(__GNUC__)
+    return __builtin_clzll(val);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, val);
+    return 63 - static_cast<int>(index);
+#elif defined(_MSC_VER)
+    unsigned long index;
+    if (_BitScanReverse(&index, static_cast<unsigned long>(val >> 32))) {
+        return 31 - static_cast<int>(index);
+    }
+    _BitScanReverse(&index, static_cast<unsigned long>(val));
+    return 63 - static_cast<int>(index);
+#else
+    int n = 0;
+    for (uint64_t bit = 1ULL << 63; (val & bit) == 0; bit >>= 1) {
+        n++;
+    }
+    return n;
+#endif
+}
+
+/**
+ * Returns the number of significant bytes of a value, at least 1.
+ */
+static inline int getSignificantBytes(const uint64_t val)
+{
+    return (64 - numberOfLeadingZeros(val | 1) + 7) / 8;
+}
+
+/**
+ * Writes the hex digits of the "nbBytes" least significant bytes of a value.
+ */
+static inline size_t writeHex(uint64_t val, const int nbBytes, char* dest)
+{
+    for (int i = nbBytes - 1; i >= 0; i--) {
+        std::memcpy(dest + 2 * i, BYTE_TO_HEX + 2 * (val & 0xFF), 2);
+        val >>= 8;
+    }
+
+    return static_cast<size_t>(2 * nbBytes);
+}
+
+const size_t HexUtil::npos;
+
+HexUtil::HexUtil() {}
+
+bool HexUtil::isValid(const std::string& hex)
+{
+    return isValid(hex.data(), hex.length());
+}
+
+bool HexUtil::isValid(const char* hex, const size_t length)
+{
+    if (length == 0 || length % 2 != 0) {
+        return false;
+    }
+
+    return decodeHex(hex, length, nullptr) == npos;
+}
+
+const std::vector<uint8_t> HexUtil::toByteArray(const std::string& hex)
+{
     if (hex.length() % 2) {
         throw StringIndexOutOfBoundsException("string has odd length");
     }
 
-    for (int i = 0; i < static_cast<int>(hex.length()); i += 2) {
-        tab[i / 2] = ((mHexToNibble[hex.at(i)] << 4) +
-                      (mHexToNibble[hex.at(i + 1)] & 0xFF));
+    std::vector<uint8_t> tab(hex.size() / 2);
+
+    if (!tab.empty()) {
+        toByteArray(hex.data(), hex.length(), tab.data());
     }
 
     return tab;
 }
 
+size_t HexUtil::toByteArray(const char* hex, const size_t length, uint8_t* dest)
+{
+    if (length % 2) {
+        throw StringIndexOutOfBoundsException("string has odd length");
+    }
+
+    const size_t offset = decodeHex(hex, length, dest);
+
+    if (offset != npos) {
+        /* Not an hex string: lenient conversion of the remaining characters */
+        for (size_t i = offset & ~static_cast<size_t>(1); i < length; i += 2) {
+            dest[i / 2] = static_cast<uint8_t>(
+                (HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])] << 4) +
+                HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i + 1])]);
+        }
+    }
+
+    return length / 2;
+}
+
+size_t HexUtil::decode(const std::string& hex, std::vector<uint8_t>& dest)
+{
+    dest.resize(hex.length() / 2);
+
+    return decode(hex.data(), hex.length(), dest.data());
+}
+
+size_t HexUtil::decode(const char* hex, const size_t length, uint8_t* dest)
+{
+    const size_t evenLength = length & ~static_cast<size_t>(1);
+
+    if (evenLength != 0) {
+        const size_t offset = decodeHex(hex, evenLength, dest);
+
+        if (offset != npos) {
+            return offset;
+        }
+    }
+
+    return evenLength != length ? evenLength : npos;
+}
+
 uint8_t HexUtil::toByte(const std::string& hex)
+{
+    return toByte(hex.data(), hex.length());
+}
+
+uint8_t HexUtil::toByte(const char* hex, const size_t length)
 {
     uint8_t val = 0;
 
-    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+    for (size_t i = 0; i < length; i++) {
         val <<= 4;
-        val |= (mHexToNibble[hex.at(i)] & 0xFF);
+        val |= (HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])] & 0xFF);
     }
 
     return val;
 }
 
 uint16_t HexUtil::toShort(const std::string& hex)
+{
+    return toShort(hex.data(), hex.length());
+}
+
+uint16_t HexUtil::toShort(const char* hex, const size_t length)
 {
     uint16_t val = 0;
 
-    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+    for (size_t i = 0; i < length; i++) {
         val <<= 4;
-        val |= (mHexToNibble[hex.at(i)] & 0xFF);
+        val |= (HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])] & 0xFF);
     }
 
     return val;
 }
 
 uint32_t HexUtil::toInt(const std::string& hex)
+{
+    return toInt(hex.data(), hex.length());
+}
+
+uint32_t HexUtil::toInt(const char* hex, const size_t length)
 {
     uint32_t val = 0;
 
-    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+    for (size_t i = 0; i < length; i++) {
         val <<= 4;
-        val |= (mHexToNibble[hex.at(i)] & 0xFF);
+        val |= (HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])] & 0xFF);
     }
 
     return val;
 }
 
 uint64_t HexUtil::toLong(const std::string& hex)
+{
+    return toLong(hex.data(), hex.length());
+}
+
+uint64_t HexUtil::toLong(const char* hex, const size_t length)
 {
     uint64_t val = 0;
 
-    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+    for (size_t i = 0; i < length; i++) {
         val <<= 4;
-        val |= (mHexToNibble[hex.at(i)] & 0xFF);
+        val |= (HEX_TO_NIBBLE[static_cast<uint8_t>(hex[i])] & 0xFF);
     }
 
     return val;
@@ -144,95 +671,102 @@ uint64_t HexUtil::toLong(const std::string& hex)
 
 const std::string HexUtil::toHex(const std::vector<uint8_t>& tab)
 {
-    std::stringstream ss;
+    std::string hex(tab.size() * 2, '\0');
 
-    for (const auto& b : tab) {
-        ss << (mByteToHex[b & 0xFF]);
+    if (!tab.empty()) {
+        toHex(tab.data(), tab.size(), &hex[0]);
     }
 
-    return ss.str();
+    return hex;
+}
+
+size_t HexUtil::toHex(const uint8_t* src, const size_t length, char* dest)
+{
+    encodeHex(src, length, dest);
+
+    return 2 * length;
 }
 
 const std::string HexUtil::toHex(const uint8_t val)
 {
-    return mByteToHex[val & 0xFF];
+    return std::string(BYTE_TO_HEX + 2 * val, 2);
+}
+
+size_t HexUtil::toHex(const uint8_t val, char* dest)
+{
+    return writeHex(val, 1, dest);
 }
 
 const std::string HexUtil::toHex(const uint16_t val)
 {
-    if ((val & 0xFF00) == 0) {
-        return mByteToHex[val & 0xFF];
-    }
+    char hex[4];
+
+    return std::string(hex, toHex(val, hex));
+}
+
+size_t HexUtil::toHex(const uint16_t val, char* dest)
+{
+    return writeHex(val, getSignificantBytes(val), dest);
+}
+
+const std::string HexUtil::toFixedHex(const uint16_t val)
+{
+    char hex[4];
 
-    return mByteToHex[val >> 8 & 0xFF] + mByteToHex[val & 0xFF];
+    return std::string(hex, toFixedHex(val, hex));
+}
+
+size_t HexUtil::toFixedHex(const uint16_t val, char* dest)
+{
+    return writeHex(val, 2, dest);
 }
 
 const std::string HexUtil::toHex(const uint32_t val)
 {
-    if ((val & 0xFFFFFF00) == 0) {
-        return mByteToHex[val & 0xFF];
-    } else if ((val & 0xFFFF0000) == 0) {
-        return mByteToHex[val >> 8 & 0xFF] +
-               mByteToHex[val & 0xFF];
-    } else if ((val & 0xFF000000) == 0) {
-        return mByteToHex[val >> 16 & 0xFF] +
-               mByteToHex[val >> 8 & 0xFF] +
-               mByteToHex[val & 0xFF];
-    }
+    char hex[8];
+
+    return std::string(hex, toHex(val, hex));
+}
+
+size_t HexUtil::toHex(const uint32_t val, char* dest)
+{
+    return writeHex(val, getSignificantBytes(val), dest);
+}
+
+const std::string HexUtil::toFixedHex(const uint32_t val)
+{
+    char hex[8];
 
-    return mByteToHex[val >> 24 & 0xFF] +
-           mByteToHex[val >> 16 & 0xFF] +
-           mByteToHex[val >> 8 & 0xFF] +
-           mByteToHex[val & 0xFF];
+    return std::string(hex, toFixedHex(val, hex));
+}
+
+size_t HexUtil::toFixedHex(const uint32_t val, char* dest)
+{
+    return writeHex(val, 4, dest);
 }
 
 const std::string HexUtil::toHex(const uint64_t val)
 {
-    if ((val & 0xFFFFFFFFFFFFFF00L) == 0) {
-        return mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFFFFFFFFFFFF0000L) == 0) {
-        return mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFFFFFFFFFF000000L) == 0) {
-        return mByteToHex[(int) (val >> 16 & 0xFF)] +
-               mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFFFFFFFF00000000L) == 0) {
-        return mByteToHex[(int) (val >> 24 & 0xFF)] +
-               mByteToHex[(int) (val >> 16 & 0xFF)] +
-               mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFFFFFF0000000000L) == 0) {
-        return mByteToHex[(int) (val >> 32 & 0xFF)] +
-               mByteToHex[(int) (val >> 24 & 0xFF)] +
-               mByteToHex[(int) (val >> 16 & 0xFF)] +
-               mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFFFF000000000000L) == 0) {
-        return mByteToHex[(int) (val >> 40 & 0xFF)] +
-               mByteToHex[(int) (val >> 32 & 0xFF)] +
-               mByteToHex[(int) (val >> 24 & 0xFF)] +
-               mByteToHex[(int) (val >> 16 & 0xFF)] +
-               mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    } else if ((val & 0xFF00000000000000L) == 0) {
-        return mByteToHex[(int) (val >> 48 & 0xFF)] +
-               mByteToHex[(int) (val >> 40 & 0xFF)] +
-               mByteToHex[(int) (val >> 32 & 0xFF)] +
-               mByteToHex[(int) (val >> 24 & 0xFF)] +
-               mByteToHex[(int) (val >> 16 & 0xFF)] +
-               mByteToHex[(int) (val >> 8 & 0xFF)] +
-               mByteToHex[(int) (val & 0xFF)];
-    }
-
-    return mByteToHex[(int) (val >> 56 & 0xFF)] +
-           mByteToHex[(int) (val >> 48 & 0xFF)] +
-           mByteToHex[(int) (val >> 40 & 0xFF)] +
-           mByteToHex[(int) (val >> 32 & 0xFF)] +
-           mByteToHex[(int) (val >> 24 & 0xFF)] +
-           mByteToHex[(int) (val >> 16 & 0xFF)] +
-           mByteToHex[(int) (val >> 8 & 0xFF)] +
-           mByteToHex[(int) (val & 0xFF)];
+    char hex[16];
+
+    return std::string(hex, toHex(val, hex));
+}
+
+size_t HexUtil::toHex(const uint64_t val, char* dest)
+{
+    return writeHex(val, getSignificantBytes(val), dest);
+}
+
+const std::string HexUtil::toFixedHex(const uint64_t val)
+{
+    char hex[16];
+
+    return std::string(hex, toFixedHex(val, hex));
+}
+
+size_t HexUtil::toFixedHex(const uint64_t val, char* dest)
+{
+    return writeHex(val, 8, dest);
 }
 
 }
@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 #include <string>
 #include <vector>
@@ -25,6 +26,14 @@ namespace util {
 
 class KEYPLEUTIL_API HexUtil final {
 public:
+    /**
+     * Value returned by {@link #decode(const std::string&, std::vector<uint8_t>&)} when the
+     * conversion succeeded.
+     *
+     * @since 2.4.0
+     */
+    static const size_t npos = static_cast<size_t>(-1);
+
     /**
      * Checks if a string is formed by an even number of hexadecimal digits.
      *
@@ -39,6 +48,17 @@ public:
      */
     static bool isValid(const std::string& hex);
 
+    /**
+     * Checks if a character buffer is formed by an even number of hexadecimal digits.
+     *
+     * @param hex The characters to check.
+     * @param length The number of characters.
+     * @return True if the characters match the expected hexadecimal representation, false
+     *         otherwise.
+     * @since 2.4.0
+     */
+    static bool isValid(const char* hex, const size_t length);
+
     /**
      * Converts a hexadecimal string to a byte array.
      *
@@ -53,6 +73,52 @@ public:
      */
     static const std::vector<uint8_t> toByteArray(const std::string& hex);
 
+    /**
+     * Converts hexadecimal characters to bytes written into a caller provided buffer.
+     *
+     * <p>Caution: the result may be erroneous if the characters are not all hexadecimal digits.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @param dest The destination buffer, at least (length / 2) bytes long.
+     * @return The number of bytes written (length / 2).
+     * @throw StringIndexOutOfBoundsException If the length is odd.
+     * @since 2.4.0
+     */
+    static size_t toByteArray(const char* hex, const size_t length, uint8_t* dest);
+
+    /**
+     * Checks and converts a hexadecimal string to a byte array in a single pass.
+     *
+     * <p>This is the equivalent of {@link #isValid(const std::string&)} followed by {@link
+     * #toByteArray(const std::string&)}, without walking the string twice. Unlike {@link
+     * #isValid(const std::string&)}, an empty string is accepted and produces an empty byte array.
+     *
+     * @param hex The hexadecimal string to convert.
+     * @param dest The destination byte array, resized to (size of the input string / 2). Its
+     *        content is unspecified if the conversion failed.
+     * @return {@link #npos} if the conversion succeeded, otherwise the offset of the first
+     *         character that is not an hexadecimal digit (or the offset of the last character if
+     *         the string is made of an odd number of characters).
+     * @since 2.4.0
+     */
+    static size_t decode(const std::string& hex, std::vector<uint8_t>& dest);
+
+    /**
+     * Checks and converts hexadecimal characters to bytes written into a caller provided buffer,
+     * in a single pass.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @param dest The destination buffer, at least (length / 2) bytes long. Its content is
+     *        unspecified if the conversion failed.
+     * @return {@link #npos} if the conversion succeeded, otherwise the offset of the first
+     *         character that is not an hexadecimal digit (or the offset of the last character if
+     *         the length is odd).
+     * @since 2.4.0
+     */
+    static size_t decode(const char* hex, const size_t length, uint8_t* dest);
+
     /**
      * Converts a hexadecimal string to a "byte".
      *
@@ -69,6 +135,17 @@ public:
      */
     static uint8_t toByte(const std::string& hex);
 
+    /**
+     * Converts hexadecimal characters to a "byte", with the same rules as {@link
+     * #toByte(const std::string&)}.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @return 0 if the length is 0.
+     * @since 2.4.0
+     */
+    static uint8_t toByte(const char* hex, const size_t length);
+
     /**
      * Converts a hexadecimal string to a "short".
      *
@@ -86,6 +163,17 @@ public:
      */
     static uint16_t toShort(const std::string& hex);
 
+    /**
+     * Converts hexadecimal characters to a "short", with the same rules as {@link
+     * #toShort(const std::string&)}.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @return 0 if the length is 0.
+     * @since 2.4.0
+     */
+    static uint16_t toShort(const char* hex, const size_t length);
+
     /**
      * Converts a hexadecimal string to an "integer".
      *
@@ -102,6 +190,17 @@ public:
      */
     static uint32_t toInt(const std::string& hex);
 
+    /**
+     * Converts hexadecimal characters to an "integer", with the same rules as {@link
+     * #toInt(const std::string&)}.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @return 0 if the length is 0.
+     * @since 2.4.0
+     */
+    static uint32_t toInt(const char* hex, const size_t length);
+
     /**
      * Converts a hexadecimal string to a "long".
      *
@@ -118,6 +217,17 @@ public:
      */
     static uint64_t toLong(const std::string& hex);
 
+    /**
+     * Converts hexadecimal characters to a "long", with the same rules as {@link
+     * #toLong(const std::string&)}.
+     *
+     * @param hex The hexadecimal characters to convert.
+     * @param length The number of characters.
+     * @return 0 if the length is 0.
+     * @since 2.4.0
+     */
+    static uint64_t toLong(const char* hex, const size_t length);
+
     /**
      * Converts a byte array to a hexadecimal string.
      *
@@ -127,6 +237,19 @@ public:
      */
     static const std::string toHex(const std::vector<uint8_t>& tab);
 
+    /**
+     * Converts bytes to hexadecimal characters written into a caller provided buffer.
+     *
+     * <p>No terminating null character is written.
+     *
+     * @param src The bytes to convert.
+     * @param length The number of bytes.
+     * @param dest The destination buffer, at least (2 * length) characters long.
+     * @return The number of characters written (2 * length).
+     * @since 2.4.0
+     */
+    static size_t toHex(const uint8_t* src, const size_t length, char* dest);
+
     /**
      * Converts a "byte" to a hexadecimal string.
      *
@@ -136,6 +259,16 @@ public:
      */
     static const std::string toHex(const uint8_t val);
 
+    /**
+     * Converts a "byte" to hexadecimal characters written into a caller provided buffer.
+     *
+     * @param val The byte to convert.
+     * @param dest The destination buffer, at least 2 characters long.
+     * @return The number of characters written (2).
+     * @since 2.4.0
+     */
+    static size_t toHex(const uint8_t val, char* dest);
+
     /**
      * Converts a "short" to a hexadecimal string.
      *
@@ -148,6 +281,39 @@ public:
      */
     static const std::string toHex(const uint16_t val);
 
+    /**
+     * Converts a "short" to hexadecimal characters written into a caller provided buffer.
+     *
+     * <p>Note: as for {@link #toHex(const uint16_t)}, only the significant characters are
+     * written and their number is even.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 4 characters long.
+     * @return The number of characters written (2 or 4).
+     * @since 2.4.0
+     */
+    static size_t toHex(const uint16_t val, char* dest);
+
+    /**
+     * Converts a "short" to a fixed width hexadecimal string, left padded with zeros.
+     *
+     * @param val The value to convert.
+     * @return A string containing 4 characters.
+     * @since 2.4.0
+     */
+    static const std::string toFixedHex(const uint16_t val);
+
+    /**
+     * Converts a "short" to fixed width hexadecimal characters, left padded with zeros,
+     * written into a caller provided buffer.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 4 characters long.
+     * @return The number of characters written (4).
+     * @since 2.4.0
+     */
+    static size_t toFixedHex(const uint16_t val, char* dest);
+
     /**
      * Converts an "integer" to a hexadecimal string.
      *
@@ -160,6 +326,39 @@ public:
      */
     static const std::string toHex(const uint32_t val);
 
+    /**
+     * Converts an "integer" to hexadecimal characters written into a caller provided buffer.
+     *
+     * <p>Note: as for {@link #toHex(const uint32_t)}, only the significant characters are
+     * written and their number is even.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 8 characters long.
+     * @return The number of characters written (2, 4, 6 or 8).
+     * @since 2.4.0
+     */
+    static size_t toHex(const uint32_t val, char* dest);
+
+    /**
+     * Converts an "integer" to a fixed width hexadecimal string, left padded with zeros.
+     *
+     * @param val The value to convert.
+     * @return A string containing 8 characters.
+     * @since 2.4.0
+     */
+    static const std::string toFixedHex(const uint32_t val);
+
+    /**
+     * Converts an "integer" to fixed width hexadecimal characters, left padded with zeros,
+     * written into a caller provided buffer.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 8 characters long.
+     * @return The number of characters written (8).
+     * @since 2.4.0
+     */
+    static size_t toFixedHex(const uint32_t val, char* dest);
+
     /**
      * Converts a "long" to a hexadecimal string.
      *
@@ -172,17 +371,40 @@ public:
      */
     static const std::string toHex(const uint64_t val);
 
-private:
     /**
-     * Byte to hex string conversion table
+     * Converts a "long" to hexadecimal characters written into a caller provided buffer.
+     *
+     * <p>Note: as for {@link #toHex(const uint64_t)}, only the significant characters are
+     * written and their number is even.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 16 characters long.
+     * @return The number of characters written (2, 4, 6, 8, 10, 12, 14 or 16).
+     * @since 2.4.0
+     */
+    static size_t toHex(const uint64_t val, char* dest);
+
+    /**
+     * Converts a "long" to a fixed width hexadecimal string, left padded with zeros.
+     *
+     * @param val The value to convert.
+     * @return A string containing 16 characters.
+     * @since 2.4.0
      */
-    static const std::vector<std::string> mByteToHex;
+    static const std::string toFixedHex(const uint64_t val);
 
     /**
-     * Hex digit to nibble conversion table
+     * Converts a "long" to fixed width hexadecimal characters, left padded with zeros,
+     * written into a caller provided buffer.
+     *
+     * @param val The value to convert.
+     * @param dest The destination buffer, at least 16 characters long.
+     * @return The number of characters written (16).
+     * @since 2.4.0
      */
-    static const std::vector<uint8_t> mHexToNibble;
+    static size_t toFixedHex(const uint64_t val, char* dest);
 
+private:
     /**
      *
      */
@@ -0,0 +1,83 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "MonotonicBuffer.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+MonotonicBuffer::MonotonicBuffer(const size_t capacity) : mOffset(0), mUsed(0)
+{
+    addBlock(capacity > 0 ? capacity : 1);
+}
+
+void* MonotonicBuffer::allocate(const size_t size, const size_t alignment)
+{
+    /* Blocks allocated with new[] are suitably aligned for any fundamental type */
+    size_t offset = (mOffset + alignment - 1) & ~(alignment - 1);
+
+    if (offset > mBlockSizes.back() || mBlockSizes.back() - offset < size) {
+        mUsed += mOffset;
+
+        /* Geometric growth keeps the number of blocks low */
+        const size_t doubled = 2 * mBlockSizes.back();
+        addBlock(size > doubled ? size : doubled);
+        offset = 0;
+    }
+
+    mOffset = offset + size;
+
+    return mBlocks.back().get() + offset;
+}
+
+void MonotonicBuffer::release()
+{
+    if (mBlocks.size() > 1) {
+        /* Merges the blocks so that the same usage fits in one block next time */
+        const size_t capacity = getCapacity();
+
+        mBlocks.clear();
+        mBlockSizes.clear();
+        addBlock(capacity);
+    }
+
+    mOffset = 0;
+    mUsed = 0;
+}
+
+size_t MonotonicBuffer::getUsed() const
+{
+    return mUsed + mOffset;
+}
+
+size_t MonotonicBuffer::getCapacity() const
+{
+    size_t capacity = 0;
+
+    for (const size_t size : mBlockSizes) {
+        capacity += size;
+    }
+
+    return capacity;
+}
+
+void MonotonicBuffer::addBlock(const size_t size)
+{
+    mBlocks.push_back(std::unique_ptr<uint8_t[]>(new uint8_t[size]));
+    mBlockSizes.push_back(size);
+    mOffset = 0;
+}
+
+}
+}
+}
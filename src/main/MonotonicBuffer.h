@@ -0,0 +1,239 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/* Keyple Core Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+
+/**
+ * Memory arena from which objects are allocated by moving a pointer forward, all of them being
+ * released in one go.
+ *
+ * <p>It is intended to hold the results of the processing of one card response or transaction
+ * (see {@link BerTlvUtil#parse(const std::vector<uint8_t>&, const bool, MonotonicBuffer&)}), and to
+ * be reused by the same thread for the next one. When the current block is full a new one is
+ * chained; on release the blocks are merged, so that the next use fits in a single block.
+ *
+ * <p>Standard containers use it through {@link Allocator}, whose deallocation does nothing. The
+ * containers allocated from the buffer must be destroyed before it is released.
+ *
+ * <p>This class is not thread safe.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API MonotonicBuffer final {
+public:
+    /**
+     * Standard allocator drawing from a monotonic buffer.
+     *
+     * @since 2.4.0
+     */
+    template <typename T>
+    class Allocator {
+    public:
+        typedef T value_type;
+        typedef T* pointer;
+        typedef const T* const_pointer;
+        typedef T& reference;
+        typedef const T& const_reference;
+        typedef size_t size_type;
+        typedef ptrdiff_t difference_type;
+
+        template <typename U>
+        struct rebind {
+            typedef Allocator<U> other;
+        };
+
+        /**
+         * Creates an allocator drawing from the provided buffer.
+         *
+         * @param buffer The buffer, must outlive the allocator.
+         * @since 2.4.0
+         */
+        explicit Allocator(MonotonicBuffer& buffer) : mBuffer(&buffer) {}
+
+        /**
+         * Creates an allocator drawing from the same buffer as another one.
+         *
+         * @param other The other allocator.
+         * @since 2.4.0
+         */
+        template <typename U>
+        Allocator(const Allocator<U>& other) : mBuffer(other.getBuffer()) {}
+
+        /**
+         * Allocates uninitialized storage for n objects.
+         *
+         * @since 2.4.0
+         */
+        T* allocate(const size_t n)
+        {
+            return static_cast<T*>(mBuffer->allocate(n * sizeof(T), alignof(T)));
+        }
+
+        /**
+         * Does nothing, the storage being released with the buffer.
+         *
+         * @since 2.4.0
+         */
+        void deallocate(T* p, const size_t n)
+        {
+            (void)p;
+            (void)n;
+        }
+
+        /**
+         * @since 2.4.0
+         */
+        template <typename U, typename... Args>
+        void construct(U* p, Args&&... args)
+        {
+            ::new (static_cast<void*>(p)) U(std::forward<Args>(args)...);
+        }
+
+        /**
+         * @since 2.4.0
+         */
+        template <typename U>
+        void destroy(U* p)
+        {
+            p->~U();
+        }
+
+        /**
+         * @since 2.4.0
+         */
+        size_t max_size() const
+        {
+            return static_cast<size_t>(-1) / sizeof(T);
+        }
+
+        /**
+         * Gets the buffer the allocator draws from.
+         *
+         * @since 2.4.0
+         */
+        MonotonicBuffer* getBuffer() const
+        {
+            return mBuffer;
+        }
+
+    private:
+        /**
+         *
+         */
+        MonotonicBuffer* mBuffer;
+    };
+
+    /**
+     * Creates a buffer.
+     *
+     * @param capacity The size of the first block, in bytes.
+     * @since 2.4.0
+     */
+    explicit MonotonicBuffer(const size_t capacity = 4096);
+
+    /**
+     * Allocates uninitialized storage.
+     *
+     * @param size The number of bytes.
+     * @param alignment The alignment, a power of 2 not greater than the one of std::max_align_t.
+     * @return A not null pointer, valid until the buffer is released or destroyed.
+     * @throw std::bad_alloc If a new block can't be allocated.
+     * @since 2.4.0
+     */
+    void* allocate(const size_t size, const size_t alignment);
+
+    /**
+     * Releases all the storage allocated so far, keeping the memory for the next use.
+     *
+     * @since 2.4.0
+     */
+    void release();
+
+    /**
+     * Gets the number of bytes allocated since the last release.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    size_t getUsed() const;
+
+    /**
+     * Gets the number of bytes owned by the buffer.
+     *
+     * @return A positive number.
+     * @since 2.4.0
+     */
+    size_t getCapacity() const;
+
+private:
+    /**
+     * Blocks of memory, the last one being the current one
+     */
+    std::vector<std::unique_ptr<uint8_t[]>> mBlocks;
+
+    /**
+     * Size of each block
+     */
+    std::vector<size_t> mBlockSizes;
+
+    /**
+     * Offset of the free part of the current block
+     */
+    size_t mOffset;
+
+    /**
+     * Bytes allocated in the previous blocks
+     */
+    size_t mUsed;
+
+    /**
+     * (private)<br>
+     * Chains a new block of at least the provided size.
+     */
+    void addBlock(const size_t size);
+};
+
+/**
+ * @since 2.4.0
+ */
+template <typename T, typename U>
+bool operator==(const MonotonicBuffer::Allocator<T>& a, const MonotonicBuffer::Allocator<U>& b)
+{
+    return a.getBuffer() == b.getBuffer();
+}
+
+/**
+ * @since 2.4.0
+ */
+template <typename T, typename U>
+bool operator!=(const MonotonicBuffer::Allocator<T>& a, const MonotonicBuffer::Allocator<U>& b)
+{
+    return a.getBuffer() != b.getBuffer();
+}
+
+}
+}
+}
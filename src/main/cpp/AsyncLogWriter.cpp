@@ -0,0 +1,166 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "AsyncLogWriter.h"
+
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+
+/* Util */
+#include "BinaryLogCodec.h"
+#include "Logger.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+namespace cpp {
+
+const size_t AsyncLogWriter::MAX_ARGS_LENGTH;
+
+AsyncLogWriter::AsyncLogWriter(const size_t capacity)
+: mMask(roundCapacity(capacity) - 1),
+  mSlots(new Slot[mMask + 1]),
+  mEnqueuePos(0),
+  mWritten(0),
+  mRunning(true)
+{
+    for (size_t i = 0; i <= mMask; i++) {
+        mSlots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
+    mThread = std::thread(&AsyncLogWriter::run, this);
+}
+
+AsyncLogWriter::~AsyncLogWriter()
+{
+    mRunning.store(false, std::memory_order_release);
+    mThread.join();
+}
+
+void AsyncLogWriter::push(Record&& record)
+{
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+
+    for (;;) {
+        slot = &mSlots[pos & mMask];
+        const intptr_t diff = static_cast<intptr_t>(
+            slot->sequence.load(std::memory_order_acquire) - pos);
+
+        if (diff == 0) {
+            /* Free for this turn, claimed if no other producer was faster */
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (diff < 0) {
+            /* Still holding the record of the previous turn: full */
+            std::this_thread::yield();
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        } else {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    Record& dest = slot->record;
+    dest.time = record.time;
+    dest.label = record.label;
+    dest.logger = record.logger;
+    dest.message = std::move(record.message);
+    dest.format = record.format;
+    dest.argsLength = record.argsLength;
+    if (record.format) {
+        std::memcpy(dest.args, record.args, record.argsLength);
+    }
+
+    slot->sequence.store(pos + 1, std::memory_order_release);
+}
+
+void AsyncLogWriter::flush()
+{
+    const size_t target = mEnqueuePos.load(std::memory_order_acquire);
+
+    while (mWritten.load(std::memory_order_acquire) < target) {
+        std::this_thread::yield();
+    }
+
+    std::fflush(stdout);
+}
+
+void AsyncLogWriter::run()
+{
+    int idle = 0;
+
+    for (;;) {
+        if (drain() > 0) {
+            idle = 0;
+        } else if (!mRunning.load(std::memory_order_acquire)) {
+            /* Records pushed before the stop request are written by the last drain */
+            drain();
+            std::fflush(stdout);
+            return;
+        } else if (++idle < 64) {
+            std::this_thread::yield();
+        } else {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+}
+
+size_t AsyncLogWriter::drain()
+{
+    size_t pos = mWritten.load(std::memory_order_relaxed);
+    size_t count = 0;
+
+    for (;;) {
+        Slot& slot = mSlots[pos & mMask];
+
+        if (slot.sequence.load(std::memory_order_acquire) != pos + 1) {
+            break;
+        }
+
+        const Record& record = slot.record;
+
+        if (record.format) {
+            record.logger->print(
+                record.time,
+                record.label,
+                BinaryLogCodec::decode(record.format, record.args, record.argsLength));
+        } else {
+            record.logger->print(record.time, record.label, record.message);
+        }
+
+        /* Frees the slot for the next turn */
+        slot.sequence.store(pos + mMask + 1, std::memory_order_release);
+
+        mWritten.store(++pos, std::memory_order_release);
+        count++;
+    }
+
+    return count;
+}
+
+size_t AsyncLogWriter::roundCapacity(const size_t capacity)
+{
+    size_t rounded = 2;
+
+    while (rounded < capacity) {
+        rounded <<= 1;
+    }
+
+    return rounded;
+}
+
+}
+}
+}
+}
@@ -0,0 +1,192 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <thread>
+
+/* Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+namespace cpp {
+
+class Logger;
+
+/**
+ * Background writer of the log records, used by {@link Logger} in asynchronous mode.
+ *
+ * <p>The logging threads push their records into a bounded multi-producer single-consumer ring
+ * buffer, without any lock: a slot is claimed by an atomic increment, filled, then published. A
+ * background thread formats the headers (timestamps), decodes the binary records, and writes the
+ * records to the standard output in the order of their claims.
+ *
+ * <p>When the ring buffer is full, the producers wait (yield) for the background thread to free a
+ * slot, no record being dropped.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API AsyncLogWriter final {
+public:
+    /**
+     * Maximum size of the encoded arguments of a record in binary mode.
+     *
+     * @since 2.4.0
+     */
+    static const size_t MAX_ARGS_LENGTH = 192;
+
+    /**
+     * Log record, holding either a formatted message, or a format and its arguments encoded by
+     * {@link BinaryLogCodec} (binary mode).
+     *
+     * @since 2.4.0
+     */
+    struct Record {
+        /**
+         * Time of the log call.
+         */
+        std::chrono::system_clock::time_point time;
+
+        /**
+         * Level label (e.g. "TRACE"), a string literal.
+         */
+        const char* label;
+
+        /**
+         * Logger that produced the record.
+         */
+        const Logger* logger;
+
+        /**
+         * Formatted message (text record).
+         */
+        std::string message;
+
+        /**
+         * Format, a string literal, null for a text record.
+         */
+        const char* format;
+
+        /**
+         * Length of the encoded arguments (binary record).
+         */
+        size_t argsLength;
+
+        /**
+         * Encoded arguments (binary record).
+         */
+        uint8_t args[MAX_ARGS_LENGTH];
+    };
+
+    /**
+     * Creates a writer and starts its background thread.
+     *
+     * @param capacity The number of records of the ring buffer, rounded up to a power of 2.
+     * @since 2.4.0
+     */
+    explicit AsyncLogWriter(const size_t capacity = 8192);
+
+    /**
+     * Writes the pending records and stops the background thread.
+     *
+     * @since 2.4.0
+     */
+    ~AsyncLogWriter();
+
+    /**
+     * Pushes a record (lock-free, waits if the ring buffer is full).
+     *
+     * @param record The record, moved into the ring buffer (only the encoded arguments in use are
+     *        copied).
+     * @since 2.4.0
+     */
+    void push(Record&& record);
+
+    /**
+     * Waits until all the records pushed so far are written.
+     *
+     * @since 2.4.0
+     */
+    void flush();
+
+private:
+    /**
+     * Ring buffer entry, its sequence telling whether it is free or published for a given turn
+     */
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    /**
+     *
+     */
+    const size_t mMask;
+
+    /**
+     *
+     */
+    std::unique_ptr<Slot[]> mSlots;
+
+    /**
+     * Position of the next slot to claim (producers)
+     */
+    std::atomic<size_t> mEnqueuePos;
+
+    /**
+     * Number of records written (consumer)
+     */
+    std::atomic<size_t> mWritten;
+
+    /**
+     *
+     */
+    std::atomic<bool> mRunning;
+
+    /**
+     *
+     */
+    std::thread mThread;
+
+    /**
+     * (private)<br>
+     * Background thread loop.
+     */
+    void run();
+
+    /**
+     * (private)<br>
+     * Writes the published records.
+     *
+     * @return The number of records written.
+     */
+    size_t drain();
+
+    /**
+     * (private)<br>
+     * Rounds the capacity up to a power of 2.
+     */
+    static size_t roundCapacity(const size_t capacity);
+};
+
+}
+}
+}
+}
@@ -0,0 +1,58 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "BinaryLogCodec.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+namespace cpp {
+
+std::string BinaryLogCodec::decode(const char* format, const uint8_t* args, const size_t length)
+{
+    std::ostringstream os;
+    const char* s = format;
+    size_t pos = 0;
+
+    /* Same placeholder rules as Logger::printf */
+    while (*s) {
+        if (*s == '%' && *(s + 1) != '%') {
+            if (length - pos < HEADER_SIZE) {
+                os << s << " [invalid format: missing arguments]";
+                return os.str();
+            }
+
+            Render render;
+            uint32_t argLength;
+            std::memcpy(&render, args + pos, sizeof(Render));
+            std::memcpy(&argLength, args + pos + sizeof(Render), sizeof(uint32_t));
+
+            render(os, args + pos + HEADER_SIZE, argLength);
+            pos += HEADER_SIZE + argLength;
+            s++;
+            continue;
+        }
+
+        os << *s++;
+    }
+
+    if (pos < length) {
+        os << " [invalid format: extra arguments]";
+    }
+
+    return os.str();
+}
+
+}
+}
+}
+}
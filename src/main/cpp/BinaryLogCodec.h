@@ -0,0 +1,226 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+/* Util */
+#include "KeypleUtilExport.h"
+
+namespace keyple {
+namespace core {
+namespace util {
+namespace cpp {
+
+/**
+ * Binary encoding of log arguments, rendered later by another thread (deferred formatting).
+ *
+ * <p>At the call site, each argument is only copied as raw bytes, preceded by a pointer to the
+ * function able to render it and by its size:
+ *
+ * <ul>
+ *   <li>arithmetic and enumeration values: their bytes,
+ *   <li>std::string and std::vector&lt;uint8_t&gt;: their content,
+ *   <li>pointers: the pointed value, as done by {@link Logger},
+ *   <li>any other type: its text, formatted at the call site (fallback).
+ * </ul>
+ *
+ * <p>The render functions are instantiated at the call site and use the same operator&lt;&lt; as
+ * the synchronous formatting of {@link Logger}, so that the decoded message is identical.
+ *
+ * @since 2.4.0
+ */
+class KEYPLEUTIL_API BinaryLogCodec final {
+public:
+    /**
+     * Function rendering an encoded argument.
+     *
+     * @since 2.4.0
+     */
+    typedef void (*Render)(std::ostream& os, const uint8_t* data, const size_t length);
+
+    /**
+     * Encodes arguments.
+     *
+     * @param dest The destination.
+     * @param capacity The size of the destination.
+     * @param length Set to the number of bytes written.
+     * @param args The arguments.
+     * @return False if the arguments don't fit in the destination.
+     * @since 2.4.0
+     */
+    template <typename... Args>
+    static bool encode(uint8_t* dest, const size_t capacity, size_t& length, const Args&... args)
+    {
+        uint8_t* pos = dest;
+        length = 0;
+
+        if (!encodeArgs(pos, dest + capacity, args...)) {
+            return false;
+        }
+
+        length = static_cast<size_t>(pos - dest);
+
+        return true;
+    }
+
+    /**
+     * Renders a message from its format and its encoded arguments, each '%' being replaced by the
+     * next argument as done by {@link Logger}.
+     *
+     * <p>Missing or extra arguments are reported at the end of the message (no exception is
+     * thrown, the decoding being usually done by a background thread).
+     *
+     * @param format The format.
+     * @param args The encoded arguments.
+     * @param length The length of the encoded arguments.
+     * @return The message.
+     * @since 2.4.0
+     */
+    static std::string decode(const char* format, const uint8_t* args, const size_t length);
+
+private:
+    /**
+     * (private)<br>
+     * Size of the header of an encoded argument (render function and length).
+     */
+    static const size_t HEADER_SIZE = sizeof(Render) + sizeof(uint32_t);
+
+    /**
+     * (private)<br>
+     * Appends an encoded argument.
+     */
+    static bool put(uint8_t*& pos,
+                    const uint8_t* end,
+                    const Render render,
+                    const void* data,
+                    const size_t length)
+    {
+        if (static_cast<size_t>(end - pos) < HEADER_SIZE + length) {
+            return false;
+        }
+
+        const uint32_t length32 = static_cast<uint32_t>(length);
+        std::memcpy(pos, &render, sizeof(Render));
+        std::memcpy(pos + sizeof(Render), &length32, sizeof(uint32_t));
+        std::memcpy(pos + HEADER_SIZE, data, length);
+        pos += HEADER_SIZE + length;
+
+        return true;
+    }
+
+    /**
+     * (private)
+     */
+    template <typename T>
+    static void renderValue(std::ostream& os, const uint8_t* data, const size_t)
+    {
+        T value;
+        std::memcpy(&value, data, sizeof(T));
+        os << value;
+    }
+
+    /**
+     * (private)
+     */
+    template <typename T>
+    static void renderRange(std::ostream& os, const uint8_t* data, const size_t length)
+    {
+        const T value(data, data + length);
+        os << value;
+    }
+
+    /**
+     * (private)<br>
+     * Default encoder: the text of the argument.
+     */
+    template <typename T, typename Enable = void>
+    struct Encoder {
+        static bool encode(uint8_t*& pos, const uint8_t* end, const T& value)
+        {
+            std::ostringstream os;
+            os << value;
+            const std::string text = os.str();
+
+            return put(pos, end, &renderRange<std::string>, text.data(), text.size());
+        }
+    };
+
+    template <typename T>
+    struct Encoder<T,
+                   typename std::enable_if<std::is_arithmetic<T>::value ||
+                                           std::is_enum<T>::value>::type> {
+        static bool encode(uint8_t*& pos, const uint8_t* end, const T& value)
+        {
+            return put(pos, end, &renderValue<T>, &value, sizeof(T));
+        }
+    };
+
+    template <typename Dummy>
+    struct Encoder<std::string, Dummy> {
+        static bool encode(uint8_t*& pos, const uint8_t* end, const std::string& value)
+        {
+            return put(pos, end, &renderRange<std::string>, value.data(), value.size());
+        }
+    };
+
+    template <typename Dummy>
+    struct Encoder<std::vector<uint8_t>, Dummy> {
+        static bool encode(uint8_t*& pos, const uint8_t* end, const std::vector<uint8_t>& value)
+        {
+            return put(pos, end, &renderRange<std::vector<uint8_t>>, value.data(), value.size());
+        }
+    };
+
+    template <typename T, typename Dummy>
+    struct Encoder<T*, Dummy> {
+        static bool encode(uint8_t*& pos, const uint8_t* end, T* const& value)
+        {
+            return Encoder<typename std::remove_cv<T>::type>::encode(pos, end, *value);
+        }
+    };
+
+    /**
+     * (private)
+     */
+    static bool encodeArgs(uint8_t*&, const uint8_t*)
+    {
+        return true;
+    }
+
+    /**
+     * (private)
+     */
+    template <typename T, typename... Args>
+    static bool encodeArgs(uint8_t*& pos, const uint8_t* end, const T& value, const Args&... args)
+    {
+        return Encoder<T>::encode(pos, end, value) && encodeArgs(pos, end, args...);
+    }
+
+    /**
+     * (private)
+     */
+    BinaryLogCodec();
+};
+
+}
+}
+}
+}
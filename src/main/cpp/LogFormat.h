@@ -0,0 +1,155 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <ostream>
+#include <type_traits>
+
+namespace keyple {
+namespace core {
+namespace util {
+namespace cpp {
+
+/**
+ * Compile-time parsing of log format string literals.
+ *
+ * <p>The placeholders follow the same rule as {@link Logger}: each '%' not followed by another '%'
+ * is replaced by the next argument (a pointer argument being replaced by the pointed value).
+ *
+ * <p>The format is provided as a type exposing a <code>static constexpr const char* str()</code>
+ * function (see the KEYPLE_LOG_* macros of {@link Logger}), so that the offsets of the placeholders
+ * are template arguments: {@link #format} writes each literal segment and each argument in a
+ * straight line, without scanning the format at runtime.
+ *
+ * <p>The parsing being recursive, the format length is limited by the constexpr recursion depth of
+ * the compiler (512 with GCC and Clang).
+ *
+ * @since 2.4.0
+ */
+class LogFormat final {
+public:
+    /**
+     * Counts the placeholders of a format.
+     *
+     * @param format The format.
+     * @return The number of placeholders.
+     * @since 2.4.0
+     */
+    static constexpr size_t count(const char* format)
+    {
+        return *format == '\0' ? 0 : (isPlaceholder(format) ? 1 : 0) + count(format + 1);
+    }
+
+    /**
+     * Finds the next placeholder of a format.
+     *
+     * @param format The format.
+     * @param offset The offset to start from.
+     * @return The offset of the placeholder, the length of the format if there is none.
+     * @since 2.4.0
+     */
+    static constexpr size_t next(const char* format, const size_t offset)
+    {
+        return format[offset] == '\0' || isPlaceholder(format + offset) ?
+                   offset :
+                   next(format, offset + 1);
+    }
+
+    /**
+     * Writes a message, each placeholder of the format being replaced by the next argument.
+     *
+     * <p>The number of arguments must match the number of placeholders (see {@link #count}).
+     *
+     * @tparam Format The format, exposing a static constexpr str() function.
+     * @tparam Offset The offset of the remaining part of the format.
+     * @param os The destination.
+     * @since 2.4.0
+     */
+    template <typename Format, size_t Offset = 0>
+    static void format(std::ostream& os)
+    {
+        writeSegment<Format, Offset, next(Format::str(), Offset)>(os);
+    }
+
+    /**
+     * Writes a message, each placeholder of the format being replaced by the next argument.
+     *
+     * <p>The number of arguments must match the number of placeholders (see {@link #count}).
+     *
+     * @tparam Format The format, exposing a static constexpr str() function.
+     * @tparam Offset The offset of the remaining part of the format.
+     * @param os The destination.
+     * @param value The next argument.
+     * @param args The remaining arguments.
+     * @since 2.4.0
+     */
+    template <typename Format, size_t Offset = 0, typename T, typename... Args>
+    static void format(std::ostream& os, const T& value, const Args&... args)
+    {
+        typedef std::integral_constant<size_t, next(Format::str(), Offset)> Placeholder;
+
+        writeSegment<Format, Offset, Placeholder::value>(os);
+        writeValue(os, value);
+        format<Format, Placeholder::value + 1>(os, args...);
+    }
+
+private:
+    /**
+     * (private)
+     */
+    static constexpr bool isPlaceholder(const char* format)
+    {
+        return format[0] == '%' && format[1] != '%';
+    }
+
+    /**
+     * (private)<br>
+     * Writes the literal part of the format between two offsets.
+     */
+    template <typename Format, size_t Begin, size_t End>
+    static void writeSegment(std::ostream& os)
+    {
+        if (End > Begin) {
+            os.write(Format::str() + Begin, static_cast<std::streamsize>(End - Begin));
+        }
+    }
+
+    /**
+     * (private)
+     */
+    template <typename T>
+    static void writeValue(std::ostream& os, const T& value)
+    {
+        os << value;
+    }
+
+    /**
+     * (private)
+     */
+    template <typename T>
+    static void writeValue(std::ostream& os, T* const value)
+    {
+        os << *value;
+    }
+
+    /**
+     * (private)
+     */
+    LogFormat();
+};
+
+}
+}
+}
+}
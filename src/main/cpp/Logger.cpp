@@ -21,9 +21,19 @@ namespace cpp {
 
 Logger::Level Logger::mLevel = Logger::Level::logDebug;
 
+std::atomic<AsyncLogWriter*> Logger::mAsyncWriter(nullptr);
+
+std::atomic<bool> Logger::mBinaryMode(false);
+
 Logger::Logger(const std::string& className, std::mutex* mtx)
 : className(demangle(className.c_str())), mtx(mtx) {}
 
+Logger::~Logger()
+{
+    /* Pending records refer to this logger */
+    flush();
+}
+
 std::string Logger::getClassName()
 {
     return className;
@@ -34,18 +44,75 @@ void Logger::setLoggerLevel(Logger::Level level)
     mLevel = level;
 }
 
-const std::string Logger::getCurrentTimestamp()
+void Logger::setAsyncMode(const bool enabled, const size_t capacity)
+{
+    AsyncLogWriter* const writer =
+        mAsyncWriter.exchange(enabled ? new AsyncLogWriter(capacity) : nullptr);
+
+    /* Writes the pending records of the previous writer */
+    delete writer;
+}
+
+void Logger::setBinaryMode(const bool enabled)
+{
+    mBinaryMode.store(enabled, std::memory_order_release);
+}
+
+void Logger::flush()
+{
+    AsyncLogWriter* const writer = mAsyncWriter.load(std::memory_order_acquire);
+
+    if (writer) {
+        writer->flush();
+    } else {
+        std::fflush(stdout);
+    }
+}
+
+void Logger::write(const char* label, std::string&& message) const
+{
+    AsyncLogWriter* const writer = mAsyncWriter.load(std::memory_order_acquire);
+
+    if (writer) {
+        AsyncLogWriter::Record record;
+        record.time = std::chrono::system_clock::now();
+        record.label = label;
+        record.logger = this;
+        record.message = std::move(message);
+        record.format = nullptr;
+        record.argsLength = 0;
+        writer->push(std::move(record));
+    } else {
+        print(std::chrono::system_clock::now(), label, message);
+    }
+}
+
+void Logger::print(const std::chrono::system_clock::time_point& time,
+                   const char* label,
+                   const std::string& message) const
+{
+    const std::lock_guard<std::mutex> lock(*mtx);
+
+    /* Header */
+    std::string name = className;
+    name.resize(70);
+    std::printf("[%s]   [%5s]   [%-70s]   ", getTimestamp(time).c_str(), label, name.c_str());
+
+    /* Actual log */
+    std::printf("%s", message.c_str());
+}
+
+const std::string Logger::getTimestamp(const std::chrono::system_clock::time_point& time)
 {
     using std::chrono::system_clock;
-    auto currentTime = std::chrono::system_clock::now();
     char buffer1[21];
     char buffer2[26];
 
-    auto transformed = currentTime.time_since_epoch().count() / 1000000;
+    auto transformed = time.time_since_epoch().count() / 1000000;
     auto millis = transformed % 1000;
 
     std::time_t tt;
-    tt = system_clock::to_time_t(currentTime);
+    tt = system_clock::to_time_t(time);
     auto timeinfo = localtime(&tt);
 
     strftime(buffer1, sizeof(buffer1), "%F %H:%M:%S", timeinfo);
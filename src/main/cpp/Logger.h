@@ -12,6 +12,8 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
 #include <cstdlib>
 #include <iomanip>
 #include <iostream>
@@ -30,7 +32,24 @@
 #endif
 
 /* Util */
+#include "AsyncLogWriter.h"
+#include "BinaryLogCodec.h"
 #include "KeypleUtilExport.h"
+#include "LogFormat.h"
+
+/**
+ * Most verbose level of the log statements compiled in, as a Logger::Level value: 5 (trace, the
+ * default) keeps all of them, 3 (info) removes the debug and trace ones from a release build, 0
+ * removes all of them.
+ *
+ * <p>The removed statements are still type checked, their arguments are never evaluated. The value
+ * must be the same for all the translation units (e.g. set in CMAKE_CXX_FLAGS).
+ *
+ * @since 2.4.0
+ */
+#ifndef KEYPLE_LOG_MIN_LEVEL
+#define KEYPLE_LOG_MIN_LEVEL 5
+#endif
 
 namespace keyple {
 namespace core {
@@ -56,6 +75,11 @@ public:
      */
     Logger(const std::string& className, std::mutex* mtx);
 
+    /**
+     * Destructor, waiting for the pending records in asynchronous mode
+     */
+    ~Logger();
+
     /**
      *
      */
@@ -66,13 +90,73 @@ public:
      */
     static void setLoggerLevel(Level level);
 
+    /**
+     * Indicates if the messages of a level are output, i.e. if the level is compiled in (see
+     * KEYPLE_LOG_MIN_LEVEL) and enabled by {@link #setLoggerLevel(Level)}.
+     *
+     * @param level The level.
+     * @return True if the messages of this level are output.
+     * @since 2.4.0
+     */
+    static bool isEnabled(const Level level)
+    {
+        return isCompiledIn(level) && mLevel >= level;
+    }
+
+    /**
+     * Indicates if a level is compiled in (see KEYPLE_LOG_MIN_LEVEL).
+     *
+     * @param level The level.
+     * @return True if the log statements of this level are compiled in.
+     * @since 2.4.0
+     */
+    static constexpr bool isCompiledIn(const Level level)
+    {
+        return static_cast<int>(level) <= KEYPLE_LOG_MIN_LEVEL;
+    }
+
+    /**
+     * Enables or disables the asynchronous mode, in which the log calls only format the message
+     * and push it into a lock-free ring buffer, the output being done by a background thread (see
+     * AsyncLogWriter).
+     *
+     * <p>Must not be called while other threads are logging. Disabling the mode writes the pending
+     * records first.
+     *
+     * @param enabled True to enable the asynchronous mode.
+     * @param capacity The number of records of the ring buffer.
+     * @since 2.4.0
+     */
+    static void setAsyncMode(const bool enabled, const size_t capacity = 8192);
+
+    /**
+     * Waits until all the records logged so far are written (asynchronous mode), and flushes the
+     * standard output.
+     *
+     * @since 2.4.0
+     */
+    static void flush();
+
+    /**
+     * Enables or disables the binary mode, effective in asynchronous mode only: the KEYPLE_LOG_*
+     * macros, whose format is guaranteed to be a string literal, only copy the format pointer and
+     * the raw bytes of the arguments (see BinaryLogCodec), the formatting being done by the
+     * background thread. The other log calls are formatted immediately.
+     *
+     * <p>Unlike {@link #setAsyncMode}, may be called while other threads are logging.
+     *
+     * @param enabled True to enable the binary mode.
+     * @since 2.4.0
+     */
+    static void setBinaryMode(const bool enabled);
+
     /**
      *
      */
     template <typename... Args>
     void trace(const std::string& format, Args... args)
     {
-        if (mLevel >= Level::logTrace)
+        if (isEnabled(Level::logTrace))
             log("TRACE", format, std::forward<Args>(args)...);
     }
 
@@ -82,7 +166,7 @@ public:
     template <typename... Args>
     void debug(const std::string& format, Args... args)
     {
-        if (mLevel >= Level::logDebug)
+        if (isEnabled(Level::logDebug))
             log("DEBUG", format, std::forward<Args>(args)...);
     }
 
@@ -92,7 +176,7 @@ public:
     template <typename... Args>
     void warn(const std::string& format, Args... args)
     {
-        if (mLevel >= Level::logWarn)
+        if (isEnabled(Level::logWarn))
             log("WARN", format, std::forward<Args>(args)...);
     }
 
@@ -102,7 +186,7 @@ public:
     template <typename... Args>
     void info(const std::string& format, Args... args)
     {
-        if (mLevel >= Level::logInfo)
+        if (isEnabled(Level::logInfo))
             log("INFO", format, std::forward<Args>(args)...);
     }
 
@@ -112,16 +196,62 @@ public:
     template <typename... Args>
     void error(const std::string& format, Args... args)
     {
-        if (mLevel >= Level::logError)
+        if (isEnabled(Level::logError))
             log("ERROR", format, std::forward<Args>(args)...);
     }
 
+    /**
+     * Logs a message whose format is parsed at compile time (see LogFormat), the number of
+     * placeholders being checked against the number of arguments by a static assertion.
+     *
+     * <p>Not to be called directly: use the KEYPLE_LOG_TRACE, KEYPLE_LOG_DEBUG, KEYPLE_LOG_INFO,
+     * KEYPLE_LOG_WARN and KEYPLE_LOG_ERROR macros, which provide the Format type.
+     *
+     * @tparam Format The format, exposing a static constexpr str() function.
+     * @param level The level of the message.
+     * @param label The label of the level.
+     * @param format The format, ignored (Format::str(), a string literal, being stored by the
+     *        binary mode).
+     * @param args The arguments.
+     * @since 2.4.0
+     */
+    template <typename Format, typename... Args>
+    void logFormat(const Level level, const char* label, const char* format, const Args&... args)
+    {
+        static_assert(LogFormat::count(Format::str()) == sizeof...(Args),
+                      "invalid format: the number of placeholders doesn't match the number of "
+                      "arguments");
+
+        (void)format;
+
+        if (!isEnabled(level) || pushBinary(label, Format::str(), args...)) {
+            return;
+        }
+
+        std::ostringstream os;
+        LogFormat::format<Format>(os, args...);
+
+        write(label, os.str());
+    }
+
 private:
+    friend class AsyncLogWriter;
+
     /**
      *
      */
     static Level mLevel;
 
+    /**
+     * Background writer, null in synchronous mode
+     */
+    static std::atomic<AsyncLogWriter*> mAsyncWriter;
+
+    /**
+     * Read by the logging threads, possibly while being set
+     */
+    static std::atomic<bool> mBinaryMode;
+
     /**
      *
      */
@@ -140,7 +270,19 @@ private:
     /**
      *
      */
-    static const std::string getCurrentTimestamp();
+    static const std::string getTimestamp(const std::chrono::system_clock::time_point& time);
+
+    /**
+     * Outputs a formatted message, directly or through the background writer.
+     */
+    void write(const char* label, std::string&& message) const;
+
+    /**
+     * Prints the header and the message.
+     */
+    void print(const std::chrono::system_clock::time_point& time,
+               const char* label,
+               const std::string& message) const;
 
     /**
      *
@@ -208,23 +350,47 @@ private:
 	 * defined in the header file.
 	 */
     template <typename... Args>
-    void log(const std::string& label, const std::string& format, Args... args)
+    void log(const char* label, const std::string& format, Args... args)
     {
-        const std::lock_guard<std::mutex> lock(*mtx);
-
-        /* Header */
-        std::string name = className;
-        name.resize(70);
-        std::printf("[%s]   [%5s]   [%-70s]   ",
-                    getCurrentTimestamp().c_str(),
-                    label.c_str(),
-                    name.c_str());
+        log(label, format.c_str(), args...);
+    }
 
+    template <typename... Args>
+    void log(const char* label, const char* format, Args... args)
+    {
         /* Actual log */
         std::ostringstream os;
-        printf(os, format.c_str(), args...);
-        const std::string& str = os.str();
-        std::printf("%s", str.c_str());
+        printf(os, format, args...);
+
+        write(label, os.str());
+    }
+
+    /**
+     * Pushes a binary record if the binary mode is enabled and the arguments fit in the record, the
+     * format being a string literal (read later by the background writer).
+     */
+    template <typename... Args>
+    bool pushBinary(const char* label, const char* format, const Args&... args)
+    {
+        AsyncLogWriter* const writer = mAsyncWriter.load(std::memory_order_acquire);
+
+        if (!writer || !mBinaryMode.load(std::memory_order_acquire)) {
+            return false;
+        }
+
+        AsyncLogWriter::Record record;
+
+        if (!BinaryLogCodec::encode(record.args, sizeof(record.args), record.argsLength, args...)) {
+            return false;
+        }
+
+        record.time = std::chrono::system_clock::now();
+        record.label = label;
+        record.logger = this;
+        record.format = format;
+        writer->push(std::move(record));
+
+        return true;
     }
 };
 
@@ -232,3 +398,55 @@ private:
 }
 }
 }
+
+/**
+ * (private)<br>
+ * First argument of a list, the list being never empty when expanded (-pedantic).
+ */
+#define KEYPLE_LOG_EXPAND_(x) x
+#define KEYPLE_LOG_FIRST_(first, ...) first
+#define KEYPLE_LOG_FORMAT_(...) KEYPLE_LOG_EXPAND_(KEYPLE_LOG_FIRST_(__VA_ARGS__, ~))
+
+/**
+ * (private)<br>
+ * Declares the format as a local type and logs the message, the arguments being evaluated only if
+ * the level is enabled.
+ */
+#define KEYPLE_LOG_(logger, level, label, ...)                                                    \
+    do {                                                                                          \
+        if (keyple::core::util::cpp::Logger::isEnabled(level)) {                                  \
+            struct KeypleLogFormat {                                                              \
+                static constexpr const char* str()                                                \
+                {                                                                                 \
+                    return KEYPLE_LOG_FORMAT_(__VA_ARGS__);                                       \
+                }                                                                                 \
+            };                                                                                    \
+            (logger)->logFormat<KeypleLogFormat>(level, label, __VA_ARGS__);                      \
+        }                                                                                         \
+    } while (0)
+
+/**
+ * Logging macros whose format, a string literal, is parsed at compile time: the number of
+ * placeholders is checked against the number of arguments by a static assertion, and the message
+ * is written without scanning the format at runtime.
+ *
+ * <p>Unlike the Logger methods, the arguments (e.g. HexUtil::toHex(apdu)) are not evaluated when
+ * the level is disabled, and the statements of the levels above KEYPLE_LOG_MIN_LEVEL are removed
+ * at compile time.
+ *
+ * <pre>
+ * KEYPLE_LOG_DEBUG(mLogger, "APDU sent: %\n", HexUtil::toHex(apdu));
+ * </pre>
+ *
+ * @since 2.4.0
+ */
+#define KEYPLE_LOG_TRACE(logger, ...)                                                             \
+    KEYPLE_LOG_(logger, keyple::core::util::cpp::Logger::Level::logTrace, "TRACE", __VA_ARGS__)
+#define KEYPLE_LOG_DEBUG(logger, ...)                                                             \
+    KEYPLE_LOG_(logger, keyple::core::util::cpp::Logger::Level::logDebug, "DEBUG", __VA_ARGS__)
+#define KEYPLE_LOG_INFO(logger, ...)                                                              \
+    KEYPLE_LOG_(logger, keyple::core::util::cpp::Logger::Level::logInfo, "INFO", __VA_ARGS__)
+#define KEYPLE_LOG_WARN(logger, ...)                                                              \
+    KEYPLE_LOG_(logger, keyple::core::util::cpp::Logger::Level::logWarn, "WARN", __VA_ARGS__)
+#define KEYPLE_LOG_ERROR(logger, ...)                                                             \
+    KEYPLE_LOG_(logger, keyple::core::util::cpp::Logger::Level::logError, "ERROR", __VA_ARGS__)
@@ -0,0 +1,92 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "ApduBatch.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> DATA_IN = {0x12, 0x34, 0x56, 0x78};
+
+static std::vector<uint8_t> getCommand(const ApduBatch& batch, const size_t index)
+{
+    return std::vector<uint8_t>(batch.getCommand(index),
+                                batch.getCommand(index) + batch.getCommandLength(index));
+}
+
+TEST(ApduBatchTest, add_whenAllCases_shouldPackThemInOrder)
+{
+    ApduBatch batch;
+
+    batch.add(0x11, 0x22, 0x33, 0x44)
+        .add(0x11, 0x22, 0x33, 0x44, 3)
+        .add(0x11, 0x22, 0x33, 0x44, DATA_IN.data(), DATA_IN.size())
+        .add(0x11, 0x22, 0x33, 0x44, DATA_IN.data(), DATA_IN.size(), 3)
+        .add(HexUtil::toByteArray("00B2011400"));
+
+    ASSERT_EQ(batch.size(), 5U);
+    ASSERT_EQ(getCommand(batch, 0), HexUtil::toByteArray("1122334400"));
+    ASSERT_EQ(getCommand(batch, 1), HexUtil::toByteArray("1122334403"));
+    ASSERT_EQ(getCommand(batch, 2), HexUtil::toByteArray("112233440412345678"));
+    ASSERT_EQ(getCommand(batch, 3), HexUtil::toByteArray("11223344041234567803"));
+    ASSERT_EQ(getCommand(batch, 4), HexUtil::toByteArray("00B2011400"));
+    ASSERT_EQ(batch.getOffsets(), std::vector<size_t>({0, 5, 10, 19, 29, 34}));
+    ASSERT_EQ(batch.getBytes().size(), 34U);
+}
+
+TEST(ApduBatchTest, add_whenDataInIsTooLong_shouldIAEAndKeepPreviousCommands)
+{
+    ApduBatch batch;
+    const std::vector<uint8_t> dataIn(256);
+
+    batch.add(0x11, 0x22, 0x33, 0x44, 3);
+
+    EXPECT_THROW(batch.add(0x11, 0x22, 0x33, 0x44, dataIn.data(), dataIn.size()),
+                 IllegalArgumentException);
+    EXPECT_THROW(batch.add(0x11, 0x22, 0x33, 0x44, dataIn.data(), dataIn.size(), 0),
+                 IllegalArgumentException);
+
+    ASSERT_EQ(batch.size(), 1U);
+    ASSERT_EQ(batch.getBytes(), HexUtil::toByteArray("1122334403"));
+    ASSERT_EQ(batch.getOffsets(), std::vector<size_t>({0, 5}));
+
+    batch.add(0x11, 0x22, 0x33, 0x44);
+
+    ASSERT_EQ(batch.size(), 2U);
+    ASSERT_EQ(batch.getBytes(), HexUtil::toByteArray("11223344031122334400"));
+}
+
+TEST(ApduBatchTest, reset_shouldKeepTheBuffer)
+{
+    ApduBatch batch;
+    batch.add(0x11, 0x22, 0x33, 0x44, 3);
+    const uint8_t* data = batch.getBytes().data();
+
+    batch.reset();
+
+    ASSERT_EQ(batch.size(), 0U);
+    ASSERT_TRUE(batch.getBytes().empty());
+
+    batch.add(0x11, 0x22, 0x33, 0x44);
+
+    ASSERT_EQ(batch.size(), 1U);
+    ASSERT_EQ(batch.getBytes().data(), data);
+}
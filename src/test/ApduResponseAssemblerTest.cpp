@@ -0,0 +1,130 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <set>
+
+#include "ApduResponseAssembler.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+TEST(ApduResponseAssemblerTest, add_whenFinalStatusWord_shouldComplete)
+{
+    ApduResponseAssembler assembler;
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("11229000")),
+              ApduResponseAssembler::Action::COMPLETE);
+    ASSERT_TRUE(assembler.isComplete());
+    ASSERT_EQ(assembler.getApduResponse(), HexUtil::toByteArray("11229000"));
+}
+
+TEST(ApduResponseAssemblerTest, add_when61xx_shouldRequestGetResponseAndConcatenateData)
+{
+    ApduResponseAssembler assembler;
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("11226103")),
+              ApduResponseAssembler::Action::GET_RESPONSE);
+    ASSERT_EQ(assembler.getLe(), 3);
+    ASSERT_FALSE(assembler.isComplete());
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("3344556100")),
+              ApduResponseAssembler::Action::GET_RESPONSE);
+    ASSERT_EQ(assembler.getLe(), 0);
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("666282")),
+              ApduResponseAssembler::Action::COMPLETE);
+    ASSERT_EQ(assembler.getApduResponse(), HexUtil::toByteArray("1122334455666282"));
+}
+
+TEST(ApduResponseAssemblerTest, add_whenManyChunks_shouldGrowTheBufferGeometrically)
+{
+    std::vector<uint8_t> chunk(256, 0xAA);
+    chunk.push_back(0x61);
+    chunk.push_back(0x00);
+    const std::vector<uint8_t> last = HexUtil::toByteArray("9000");
+    std::set<size_t> capacities;
+
+    /* The capacity after n chunks being deterministic, each distinct value is a reallocation */
+    for (int n = 0; n <= 20; n++) {
+        ApduResponseAssembler assembler;
+
+        for (int i = 0; i < n; i++) {
+            assembler.add(chunk);
+        }
+        assembler.add(last);
+
+        ASSERT_EQ(assembler.getApduResponse().size(), n * 256U + 2U);
+        capacities.insert(assembler.getApduResponse().capacity());
+    }
+
+    /* 258 -> 516 -> 1032 -> 2064 -> 4128 -> 8256 */
+    ASSERT_LE(capacities.size(), 6U);
+}
+
+TEST(ApduResponseAssemblerTest, add_when6Cxx_shouldRequestResendAndDropIt)
+{
+    ApduResponseAssembler assembler;
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("6C1D")), ApduResponseAssembler::Action::RESEND);
+    ASSERT_EQ(assembler.getLe(), 0x1D);
+
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("AABB9000")),
+              ApduResponseAssembler::Action::COMPLETE);
+    ASSERT_EQ(assembler.getApduResponse(), HexUtil::toByteArray("AABB9000"));
+}
+
+TEST(ApduResponseAssemblerTest, add_whenNoStatusWord_shouldIAE)
+{
+    ApduResponseAssembler assembler;
+
+    EXPECT_THROW(assembler.add(HexUtil::toByteArray("90")), IllegalArgumentException);
+}
+
+TEST(ApduResponseAssemblerTest, add_whenAlreadyComplete_shouldISE)
+{
+    ApduResponseAssembler assembler;
+    assembler.add(HexUtil::toByteArray("9000"));
+
+    EXPECT_THROW(assembler.add(HexUtil::toByteArray("9000")), IllegalStateException);
+}
+
+TEST(ApduResponseAssemblerTest, getApduResponse_whenNotComplete_shouldISE)
+{
+    ApduResponseAssembler assembler;
+    assembler.add(HexUtil::toByteArray("6110"));
+
+    EXPECT_THROW(assembler.getApduResponse(), IllegalStateException);
+}
+
+TEST(ApduResponseAssemblerTest, reset_shouldKeepTheBuffer)
+{
+    ApduResponseAssembler assembler;
+    assembler.add(HexUtil::toByteArray("11229000"));
+    const uint8_t* data = assembler.getApduResponse().data();
+
+    assembler.reset();
+
+    ASSERT_FALSE(assembler.isComplete());
+    ASSERT_EQ(assembler.add(HexUtil::toByteArray("6A82")), ApduResponseAssembler::Action::COMPLETE);
+    ASSERT_EQ(assembler.getApduResponse(), HexUtil::toByteArray("6A82"));
+    ASSERT_EQ(assembler.getApduResponse().data(), data);
+}
@@ -0,0 +1,74 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "ApduResponse.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+
+static constexpr uint8_t SUCCESS[] = {0x12, 0x34, 0x90, 0x00};
+
+static_assert(ApduResponse(SUCCESS, sizeof(SUCCESS)).isSuccess(), "Constant evaluation");
+static_assert(ApduResponse(SUCCESS, sizeof(SUCCESS)).getStatusWord() == 0x9000,
+              "Constant evaluation");
+static_assert(ApduResponse(SUCCESS, sizeof(SUCCESS)).getDataLength() == 2, "Constant evaluation");
+
+TEST(ApduResponseTest, getData_whenResponseHasData_shouldPointIntoTheBuffer)
+{
+    const std::vector<uint8_t> response = HexUtil::toByteArray("1234569000");
+    const ApduResponse apduResponse(response);
+
+    ASSERT_TRUE(apduResponse.isValid());
+    ASSERT_EQ(apduResponse.getData(), response.data());
+    ASSERT_EQ(apduResponse.getDataLength(), 3U);
+    ASSERT_EQ(apduResponse.getStatusWord(), 0x9000);
+    ASSERT_EQ(apduResponse.getSw1(), 0x90);
+    ASSERT_EQ(apduResponse.getSw2(), 0x00);
+}
+
+TEST(ApduResponseTest, isValid_whenResponseIsTooShort_shouldReturnFalse)
+{
+    const std::vector<uint8_t> response = HexUtil::toByteArray("90");
+    const ApduResponse apduResponse(response);
+
+    ASSERT_FALSE(apduResponse.isValid());
+    ASSERT_EQ(apduResponse.getDataLength(), 0U);
+    ASSERT_EQ(apduResponse.getStatusWord(), 0);
+    ASSERT_FALSE(apduResponse.isSuccess());
+}
+
+TEST(ApduResponseTest, isSuccess_when9000Or61xx_shouldReturnTrue)
+{
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("9000")).isSuccess());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6110")).isSuccess());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6110")).hasMoreData());
+    ASSERT_FALSE(ApduResponse(HexUtil::toByteArray("9001")).isSuccess());
+}
+
+TEST(ApduResponseTest, classification_whenWarningOrError_shouldReportTheClass)
+{
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6283")).isWarning());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("63C2")).isWarning());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6581")).isExecutionError());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6A82")).isCheckingError());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6C1D")).isCheckingError());
+    ASSERT_TRUE(ApduResponse(HexUtil::toByteArray("6C1D")).isWrongLe());
+    ASSERT_FALSE(ApduResponse(HexUtil::toByteArray("6A82")).isWarning());
+    ASSERT_FALSE(ApduResponse(HexUtil::toByteArray("9000")).isCheckingError());
+}
@@ -0,0 +1,89 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "ApduTemplate.h"
+
+/* Keyple Core Util */
+#include "ApduUtil.h"
+#include "ArrayIndexOutOfBoundsException.h"
+#include "HexLiteral.h"
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static constexpr std::array<uint8_t, 5> READ_RECORD = HexLiteral::toByteArray("00B2000400");
+
+TEST(ApduTemplateTest, setP1AndLe_whenCompileTimeCommand_shouldPatchInPlace)
+{
+    ApduTemplate readRecord(READ_RECORD.data(), READ_RECORD.size());
+    const uint8_t* data = readRecord.getBytes().data();
+
+    readRecord.setP1(0x03).setLe(0x1D);
+
+    ASSERT_EQ(readRecord.getBytes(), HexUtil::toByteArray("00B203041D"));
+    ASSERT_EQ(readRecord.getBytes().data(), data);
+    ASSERT_EQ(readRecord.getDataLength(), 0U);
+}
+
+TEST(ApduTemplateTest, setData_whenCase4_shouldPatchOnlyTheDataBytes)
+{
+    const std::vector<uint8_t> dataIn(9, 0x00);
+    ApduTemplate update(0x00, 0xDC, 0x01, 0x44, dataIn.data(), dataIn.size(), 0x00);
+    const uint8_t value[] = {0xAA, 0xBB};
+
+    update.setCla(0x94)
+        .setP1P2(0x0244)
+        .setDataByte(0, 0x11)
+        .setDataShort(1, 0x2233)
+        .setDataInt(3, 0x44556677)
+        .setData(7, value, sizeof(value));
+
+    ASSERT_EQ(update.getBytes(), HexUtil::toByteArray("94DC02440911223344556677AABB00"));
+    ASSERT_EQ(ApduUtil::getCase(update.getBytes()), ApduUtil::ApduCase::CASE_4);
+}
+
+TEST(ApduTemplateTest, setData_whenBeyondTheDataField_shouldAIOOBE)
+{
+    const std::vector<uint8_t> dataIn(4, 0x00);
+    ApduTemplate update(0x00, 0xDC, 0x01, 0x44, dataIn.data(), dataIn.size());
+
+    EXPECT_THROW(update.setDataInt(1, 0), ArrayIndexOutOfBoundsException);
+    EXPECT_THROW(update.setDataByte(4, 0), ArrayIndexOutOfBoundsException);
+    EXPECT_THROW(update.setLe(0), IllegalStateException);
+}
+
+TEST(ApduTemplateTest, constructor_whenExtendedCommand_shouldLocateTheDataField)
+{
+    const std::vector<uint8_t> dataIn(300, 0x00);
+    ApduTemplate write(ApduUtil::buildExtended(0x00, 0xD6, 0x00, 0x00, dataIn, 0));
+
+    write.setDataShort(298, 0xABCD);
+
+    ASSERT_EQ(write.getDataLength(), 300U);
+    ASSERT_EQ(write.getBytes()[305], 0xAB);
+    ASSERT_EQ(write.getBytes()[306], 0xCD);
+    EXPECT_THROW(write.setLe(0), IllegalStateException);
+}
+
+TEST(ApduTemplateTest, constructor_whenCommandIsMalformed_shouldIAE)
+{
+    EXPECT_THROW(ApduTemplate(HexUtil::toByteArray("00DC01440412")), IllegalArgumentException);
+    EXPECT_THROW(ApduTemplate(HexUtil::toByteArray("00B201040012")), IllegalArgumentException);
+}
@@ -16,10 +16,12 @@
 
 #include "ApduUtil.h"
 #include "HexUtil.h"
+#include "IllegalArgumentException.h"
 
 using namespace testing;
 
 using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
 
 const uint8_t CLA = 0x11;
 const uint8_t INS = 0x22;
@@ -80,3 +82,203 @@ TEST(ApduUtilTest, isCase4_whenCase4_shouldReturnFalse)
 {
     ASSERT_TRUE(ApduUtil::isCase4(CASE4));
 }
+
+TEST(ApduUtilTest, build_whenDataInIsPointerAndLength_shouldReturnCase3AndCase4)
+{
+    ASSERT_EQ(ApduUtil::build(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size()), CASE3);
+    ASSERT_EQ(ApduUtil::build(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), LE), CASE4);
+}
+
+TEST(ApduUtilTest, build_whenDataInIsEmptyAndLeIsNotNull_shouldReturnCase2)
+{
+    ASSERT_EQ(ApduUtil::build(CLA, INS, P1, P2, std::vector<uint8_t>(), LE), CASE2);
+}
+
+TEST(ApduUtilTest, build_whenDataInIsTooLong_shouldIAE)
+{
+    const std::vector<uint8_t> dataIn(256);
+
+    EXPECT_THROW(ApduUtil::build(CLA, INS, P1, P2, dataIn, LE), IllegalArgumentException);
+}
+
+TEST(ApduUtilTest, write_whenBufferIsProvided_shouldWriteEachCaseAndReturnItsLength)
+{
+    uint8_t apdu[16];
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, apdu), CASE1.size());
+    ASSERT_EQ(std::vector<uint8_t>(apdu, apdu + CASE1.size()), CASE1);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, LE, apdu), CASE2.size());
+    ASSERT_EQ(std::vector<uint8_t>(apdu, apdu + CASE2.size()), CASE2);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), apdu),
+              CASE3.size());
+    ASSERT_EQ(std::vector<uint8_t>(apdu, apdu + CASE3.size()), CASE3);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), LE, apdu),
+              CASE4.size());
+    ASSERT_EQ(std::vector<uint8_t>(apdu, apdu + CASE4.size()), CASE4);
+}
+
+TEST(ApduUtilTest, write_whenVectorIsReused_shouldResizeItWithoutReallocating)
+{
+    std::vector<uint8_t> apdu;
+    apdu.reserve(32);
+    const uint8_t* data = apdu.data();
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), LE, apdu),
+              CASE4.size());
+    ASSERT_EQ(apdu, CASE4);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), apdu),
+              CASE3.size());
+    ASSERT_EQ(apdu, CASE3);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, LE, apdu), CASE2.size());
+    ASSERT_EQ(apdu, CASE2);
+
+    ASSERT_EQ(ApduUtil::write(CLA, INS, P1, P2, apdu), CASE1.size());
+    ASSERT_EQ(apdu, CASE1);
+
+    ASSERT_EQ(apdu.data(), data);
+}
+
+TEST(ApduUtilTest, buildExtended_whenDataInAndLe_shouldReturnCase4E)
+{
+    ASSERT_EQ(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN, 0x0102),
+              HexUtil::toByteArray("11223344000004123456780102"));
+}
+
+TEST(ApduUtilTest, buildExtended_whenDataInOnly_shouldReturnCase3E)
+{
+    ASSERT_EQ(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN),
+              HexUtil::toByteArray("1122334400000412345678"));
+}
+
+TEST(ApduUtilTest, buildExtended_whenLeOnly_shouldReturnCase2E)
+{
+    ASSERT_EQ(ApduUtil::buildExtended(CLA, INS, P1, P2, 0), HexUtil::toByteArray("11223344000000"));
+}
+
+TEST(ApduUtilTest, buildExtended_whenDataInIsLong_shouldEncodeLcOn2Bytes)
+{
+    const std::vector<uint8_t> dataIn(1000, 0xAA);
+    const std::vector<uint8_t> apdu = ApduUtil::buildExtended(CLA, INS, P1, P2, dataIn, 0x0200);
+
+    ASSERT_EQ(apdu.size(), 1009U);
+    ASSERT_EQ(std::vector<uint8_t>(apdu.begin(), apdu.begin() + 7),
+              HexUtil::toByteArray("112233440003E8"));
+    ASSERT_EQ(apdu[1007], 0x02);
+    ASSERT_EQ(apdu[1008], 0x00);
+    ASSERT_EQ(ApduUtil::getCase(apdu), ApduUtil::ApduCase::CASE_4E);
+}
+
+TEST(ApduUtilTest, buildExtended_whenDataInIsTooLong_shouldIAE)
+{
+    const std::vector<uint8_t> dataIn(65536);
+
+    EXPECT_THROW(ApduUtil::buildExtended(CLA, INS, P1, P2, dataIn), IllegalArgumentException);
+}
+
+TEST(ApduUtilTest, getCase_whenShortApdus_shouldReturnShortCases)
+{
+    ASSERT_EQ(ApduUtil::getCase(ApduUtil::build(CLA, INS, P1, P2)), ApduUtil::ApduCase::CASE_2);
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("11223344")), ApduUtil::ApduCase::CASE_1);
+    ASSERT_EQ(ApduUtil::getCase(CASE2), ApduUtil::ApduCase::CASE_2);
+    ASSERT_EQ(ApduUtil::getCase(CASE3), ApduUtil::ApduCase::CASE_3);
+    ASSERT_EQ(ApduUtil::getCase(CASE4), ApduUtil::ApduCase::CASE_4);
+}
+
+TEST(ApduUtilTest, getCase_whenExtendedApdus_shouldReturnExtendedCases)
+{
+    ASSERT_EQ(ApduUtil::getCase(ApduUtil::buildExtended(CLA, INS, P1, P2, 0x0100)),
+              ApduUtil::ApduCase::CASE_2E);
+    ASSERT_EQ(ApduUtil::getCase(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN)),
+              ApduUtil::ApduCase::CASE_3E);
+    ASSERT_EQ(ApduUtil::getCase(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN, 0)),
+              ApduUtil::ApduCase::CASE_4E);
+}
+
+TEST(ApduUtilTest, getCase_whenLengthDoesNotMatchLc_shouldReturnInvalid)
+{
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("112233")), ApduUtil::ApduCase::INVALID);
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("1122334404123456")),
+              ApduUtil::ApduCase::INVALID);
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("112233440000001234")),
+              ApduUtil::ApduCase::INVALID);
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("11223344000005123456780102")),
+              ApduUtil::ApduCase::INVALID);
+}
+
+TEST(ApduUtilTest, getCase_whenSixBytesWithExtendedMarker_shouldReturnInvalid)
+{
+    ASSERT_EQ(ApduUtil::getCase(HexUtil::toByteArray("00B201040012")),
+              ApduUtil::ApduCase::INVALID);
+    ASSERT_FALSE(ApduUtil::isCase4(HexUtil::toByteArray("00B201040012")));
+}
+
+TEST(ApduUtilTest, constants_whenOdrUsed_shouldBeDefined)
+{
+    const size_t& maxShortDataLength = ApduUtil::MAX_SHORT_DATA_LENGTH;
+    const size_t& maxExtendedDataLength = ApduUtil::MAX_EXTENDED_DATA_LENGTH;
+
+    ASSERT_EQ(maxShortDataLength, 255U);
+    ASSERT_EQ(maxExtendedDataLength, 65535U);
+    ASSERT_EQ(ApduUtil::CLA_CHAINING_BIT, 0x10);
+}
+
+TEST(ApduUtilTest, isCase4_whenCase4E_shouldReturnTrue)
+{
+    ASSERT_TRUE(ApduUtil::isCase4(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN, 0)));
+    ASSERT_FALSE(ApduUtil::isCase4(ApduUtil::buildExtended(CLA, INS, P1, P2, DATA_IN)));
+}
+
+TEST(ApduUtilTest, writeExtended_whenVectorIsReused_shouldResizeIt)
+{
+    std::vector<uint8_t> apdu;
+
+    ASSERT_EQ(ApduUtil::writeExtended(CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), 3, apdu),
+              13U);
+    ASSERT_EQ(ApduUtil::writeExtended(CLA, INS, P1, P2, 3, apdu), 7U);
+    ASSERT_EQ(apdu, HexUtil::toByteArray("11223344000003"));
+}
+
+TEST(ApduUtilTest, writeChained_whenDataExceedsMaxLength_shouldSetChainingBitAndLeOnLast)
+{
+    const std::vector<uint8_t> dataIn = HexUtil::toByteArray("0102030405");
+    std::vector<uint8_t> apdus;
+    std::vector<size_t> offsets;
+
+    ASSERT_EQ(ApduUtil::writeChained(
+                  0x00, INS, P1, P2, dataIn.data(), dataIn.size(), LE, 2, apdus, offsets),
+              3U);
+    ASSERT_EQ(apdus, HexUtil::toByteArray("10223344020102"
+                                          "10223344020304"
+                                          "00223344010503"));
+    ASSERT_EQ(offsets, std::vector<size_t>({0, 7, 14, 21}));
+}
+
+TEST(ApduUtilTest, writeChained_whenDataFitsAndNoLe_shouldWriteOneCase3)
+{
+    std::vector<uint8_t> apdus;
+    std::vector<size_t> offsets;
+
+    ASSERT_EQ(ApduUtil::writeChained(
+                  CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), 255, apdus, offsets),
+              1U);
+    ASSERT_EQ(apdus, CASE3);
+    ASSERT_EQ(offsets, std::vector<size_t>({0, CASE3.size()}));
+}
+
+TEST(ApduUtilTest, writeChained_whenMaxLengthIsInvalid_shouldIAE)
+{
+    std::vector<uint8_t> apdus;
+    std::vector<size_t> offsets;
+
+    EXPECT_THROW(ApduUtil::writeChained(
+                     CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), 0, apdus, offsets),
+                 IllegalArgumentException);
+    EXPECT_THROW(ApduUtil::writeChained(
+                     CLA, INS, P1, P2, DATA_IN.data(), DATA_IN.size(), 256, apdus, offsets),
+                 IllegalArgumentException);
+}
@@ -0,0 +1,143 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+/* Util */
+#include "AsyncLogWriter.h"
+#include "Logger.h"
+#include "LoggerFactory.h"
+
+using namespace testing;
+
+using namespace keyple::core::util::cpp;
+
+class AsyncLogWriterTest : public Test {
+protected:
+    void SetUp() override
+    {
+        Logger::setLoggerLevel(Logger::Level::logInfo);
+    }
+
+    void TearDown() override
+    {
+        Logger::setAsyncMode(false);
+        Logger::setLoggerLevel(Logger::Level::logError);
+    }
+};
+
+TEST_F(AsyncLogWriterTest, flush_whenSeveralThreadsLog_shouldWriteAllRecords)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(AsyncLogWriterTest));
+    std::vector<std::thread> threads;
+
+    /* Ring buffer smaller than the number of records, producers have to wait */
+    Logger::setAsyncMode(true, 16);
+
+    internal::CaptureStdout();
+
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&logger, t]() {
+            for (int i = 0; i < 100; i++) {
+                logger->info("thread % record %\n", t, i);
+            }
+        });
+    }
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    Logger::flush();
+
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_EQ(std::count(output.begin(), output.end(), '\n'), 400);
+    ASSERT_NE(output.find("thread 3 record 99\n"), std::string::npos);
+}
+
+TEST_F(AsyncLogWriterTest, setAsyncMode_whenDisabled_shouldWritePendingRecords)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(AsyncLogWriterTest));
+
+    Logger::setAsyncMode(true);
+
+    internal::CaptureStdout();
+
+    logger->info("pending %\n", 1);
+    Logger::setAsyncMode(false);
+    logger->info("direct %\n", 2);
+
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_LT(output.find("pending 1\n"), output.find("direct 2\n"));
+    ASSERT_NE(output.find("[ INFO]"), std::string::npos);
+}
+
+TEST_F(AsyncLogWriterTest, setBinaryMode_whenLogMacro_shouldWriteTheSameMessages)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(AsyncLogWriterTest));
+    const std::string text = "text";
+    const std::string largeText(AsyncLogWriter::MAX_ARGS_LENGTH, 'x');
+    const std::string format = "non literal %\n";
+
+    Logger::setAsyncMode(true);
+    Logger::setBinaryMode(true);
+
+    internal::CaptureStdout();
+
+    KEYPLE_LOG_INFO(logger, "binary % %\n", text, 12);
+    KEYPLE_LOG_INFO(logger, "too large %\n", largeText);
+    logger->info(format, 3);
+    Logger::flush();
+
+    Logger::setBinaryMode(false);
+
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_NE(output.find("binary text 12\n"), std::string::npos);
+    ASSERT_NE(output.find("too large " + largeText + "\n"), std::string::npos);
+    ASSERT_NE(output.find("non literal 3\n"), std::string::npos);
+}
+
+TEST_F(AsyncLogWriterTest, setBinaryMode_whenFormatIsACharArray_shouldFormatItImmediately)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(AsyncLogWriterTest));
+
+    Logger::setAsyncMode(true);
+    Logger::setBinaryMode(true);
+
+    internal::CaptureStdout();
+
+    for (int i = 0; i < 3; i++) {
+        char format[32];
+        std::snprintf(format, sizeof(format), "value #%d = %%\n", i);
+        logger->info(format, i * 10);
+        std::memset(format, 'Z', sizeof(format) - 1);
+    }
+    Logger::flush();
+
+    Logger::setBinaryMode(false);
+
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_NE(output.find("value #0 = 0\n"), std::string::npos);
+    ASSERT_NE(output.find("value #2 = 20\n"), std::string::npos);
+    ASSERT_EQ(output.find("ZZ"), std::string::npos);
+}
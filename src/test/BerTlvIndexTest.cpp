@@ -0,0 +1,137 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "BerTlvIndex.h"
+
+/* Keyple Core Util */
+#include "BerTlvUtil.h"
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> TLV1 = HexUtil::toByteArray(
+    "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C2005141001");
+
+static const std::vector<uint8_t> TLV2 = HexUtil::toByteArray(
+    "E030C106200107021D01C106202009021D04C106206919091D01C106201008041D03C10620401D021D01C10620501E"
+    "021D01");
+
+TEST(BerTlvIndexTest, size_whenStructureIsEmpty_shouldReturnZero)
+{
+    BerTlvIndex index(nullptr, 0);
+
+    ASSERT_EQ(index.size(), 0U);
+    ASSERT_EQ(index.indexOf(0x84), -1);
+    ASSERT_EQ(index.indexOfChild(-1, 0x84), -1);
+}
+
+TEST(BerTlvIndexTest, indexOf_whenTagIsPresent_shouldReturnPositionInDocumentOrder)
+{
+    BerTlvIndex index(TLV1);
+
+    ASSERT_EQ(index.size(), 6U);
+    ASSERT_EQ(index.indexOf(0x6F), 0);
+    ASSERT_EQ(index.indexOf(0x84), 1);
+    ASSERT_EQ(index.indexOf(0xA5), 2);
+    ASSERT_EQ(index.indexOf(0xBF0C), 3);
+    ASSERT_EQ(index.indexOf(0xC7), 4);
+    ASSERT_EQ(index.indexOf(0x53), 5);
+
+    const std::vector<uint8_t> value(index.getValue(1),
+                                     index.getValue(1) + index.getTlv(1).valueLength);
+    ASSERT_EQ(value, HexUtil::toByteArray("315449432E49434131"));
+}
+
+TEST(BerTlvIndexTest, indexOf_whenTagIsAbsent_shouldReturnMinusOne)
+{
+    BerTlvIndex index(TLV1);
+
+    ASSERT_EQ(index.indexOf(0x4F), -1);
+    ASSERT_EQ(index.indexOf(0x84, 1), -1);
+    ASSERT_EQ(index.count(0x4F), 0U);
+}
+
+TEST(BerTlvIndexTest, indexOf_whenTagIsRepeated_shouldReturnRequestedOccurrence)
+{
+    BerTlvIndex index(TLV2);
+
+    ASSERT_EQ(index.count(0xC1), 6U);
+    ASSERT_EQ(index.indexOf(0xC1), 1);
+    ASSERT_EQ(index.indexOf(0xC1, 5), 6);
+    ASSERT_EQ(index.indexOf(0xC1, 6), -1);
+
+    const std::vector<uint8_t> value(index.getValue(6),
+                                     index.getValue(6) + index.getTlv(6).valueLength);
+    ASSERT_EQ(value, HexUtil::toByteArray("20501E021D01"));
+}
+
+TEST(BerTlvIndexTest, getParent_shouldReturnEnclosingConstructedTlv)
+{
+    BerTlvIndex index(TLV1);
+
+    ASSERT_EQ(index.getParent(0), -1);
+    ASSERT_EQ(index.getParent(1), 0);
+    ASSERT_EQ(index.getParent(2), 0);
+    ASSERT_EQ(index.getParent(3), 2);
+    ASSERT_EQ(index.getParent(4), 3);
+    ASSERT_EQ(index.getParent(5), 3);
+}
+
+TEST(BerTlvIndexTest, indexOfChild_shouldOnlySearchDirectChildren)
+{
+    BerTlvIndex index(TLV1);
+
+    ASSERT_EQ(index.indexOfChild(-1, 0x6F), 0);
+    ASSERT_EQ(index.indexOfChild(-1, 0x84), -1);
+    ASSERT_EQ(index.indexOfChild(0, 0x84), 1);
+    ASSERT_EQ(index.indexOfChild(0, 0xA5), 2);
+    ASSERT_EQ(index.indexOfChild(0, 0xC7), -1);
+    ASSERT_EQ(index.indexOfChild(2, 0xBF0C), 3);
+    ASSERT_EQ(index.indexOfChild(3, 0x53), 5);
+    ASSERT_EQ(index.indexOfChild(3, 0x84), -1);
+}
+
+TEST(BerTlvIndexTest, toMap_shouldMatchBerTlvUtilParse)
+{
+    BerTlvIndex index1(TLV1);
+    BerTlvIndex index2(TLV2);
+
+    ASSERT_EQ(index1.toMap(false), BerTlvUtil::parse(TLV1, false));
+    ASSERT_EQ(index1.toMap(true), BerTlvUtil::parse(TLV1, true));
+    ASSERT_EQ(index2.toMap(false), BerTlvUtil::parse(TLV2, false));
+    ASSERT_EQ(index2.toMap(true), BerTlvUtil::parse(TLV2, true));
+}
+
+TEST(BerTlvIndexTest, toSimpleMap_shouldMatchBerTlvUtilParseSimple)
+{
+    BerTlvIndex index1(TLV1);
+    BerTlvIndex index2(TLV2);
+
+    ASSERT_EQ(index1.toSimpleMap(false), BerTlvUtil::parseSimple(TLV1, false));
+    ASSERT_EQ(index1.toSimpleMap(true), BerTlvUtil::parseSimple(TLV1, true));
+    ASSERT_EQ(index2.toSimpleMap(false), BerTlvUtil::parseSimple(TLV2, false));
+    ASSERT_EQ(index2.toSimpleMap(true), BerTlvUtil::parseSimple(TLV2, true));
+}
+
+TEST(BerTlvIndexTest, BerTlvIndex_whenStructureIsInvalid_shouldThrowIAE)
+{
+    const std::vector<uint8_t> invalid = HexUtil::toByteArray("6F0584");
+
+    EXPECT_THROW(BerTlvIndex index(invalid), IllegalArgumentException);
+}
@@ -0,0 +1,101 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "BerTlvPath.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> PPSE = HexUtil::toByteArray(
+    "6F3F840E325041592E5359532E4444463031A52DBF0C2A610E4F07A0000000042010870102730061"
+    "184F07A0000000041010500A4D415354455243415244870101");
+
+static std::vector<uint8_t> getValue(const std::vector<uint8_t>& data,
+                                     const BerTlvReader::Tlv& tlv)
+{
+    return std::vector<uint8_t>(data.begin() + tlv.valueOffset,
+                                data.begin() + tlv.valueOffset + tlv.valueLength);
+}
+
+TEST(BerTlvPathTest, BerTlvPath_shouldCompileTagIds)
+{
+    BerTlvPath path("6F/A5/BF0C/61/4F");
+
+    ASSERT_EQ(path.getTags(), std::vector<int>({0x6F, 0xA5, 0xBF0C, 0x61, 0x4F}));
+}
+
+TEST(BerTlvPathTest, BerTlvPath_whenPathIsInvalid_shouldThrowIAE)
+{
+    EXPECT_THROW(BerTlvPath(""), IllegalArgumentException);
+    EXPECT_THROW(BerTlvPath("6F//4F"), IllegalArgumentException);
+    EXPECT_THROW(BerTlvPath("6F/A5/"), IllegalArgumentException);
+    EXPECT_THROW(BerTlvPath("6F/A"), IllegalArgumentException);
+    EXPECT_THROW(BerTlvPath("6F/XY"), IllegalArgumentException);
+    EXPECT_THROW(BerTlvPath("6F/DF81828301"), IllegalArgumentException);
+}
+
+TEST(BerTlvPathTest, find_whenPathExists_shouldReturnFirstMatchingTlv)
+{
+    BerTlvPath path("6F/A5/BF0C/61/4F");
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(path.find(PPSE, tlv));
+    ASSERT_EQ(tlv.tag, 0x4F);
+    ASSERT_EQ(tlv.depth, 4);
+    ASSERT_EQ(getValue(PPSE, tlv), HexUtil::toByteArray("A0000000042010"));
+}
+
+TEST(BerTlvPathTest, find_whenFirstBranchDoesNotMatch_shouldSearchNextSiblings)
+{
+    BerTlvPath path("6F/A5/BF0C/61/50");
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(path.find(PPSE, tlv));
+    ASSERT_EQ(tlv.tag, 0x50);
+    ASSERT_EQ(getValue(PPSE, tlv), HexUtil::toByteArray("4D415354455243415244"));
+}
+
+TEST(BerTlvPathTest, find_whenPathIsAbsent_shouldReturnFalse)
+{
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_FALSE(BerTlvPath("6F/4F").find(PPSE, tlv));
+    ASSERT_FALSE(BerTlvPath("6F/A5/BF0C/61/5F2D").find(PPSE, tlv));
+    ASSERT_FALSE(BerTlvPath("A5").find(PPSE, tlv));
+}
+
+TEST(BerTlvPathTest, find_whenPathIsTopLevelTag_shouldReturnIt)
+{
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(BerTlvPath("6F").find(PPSE.data(), PPSE.size(), tlv));
+    ASSERT_EQ(tlv.offset, 0U);
+    ASSERT_EQ(tlv.valueLength, PPSE.size() - 2);
+}
+
+TEST(BerTlvPathTest, find_whenSkippedPartIsInvalid_shouldIgnoreIt)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("6F078401AAA5028580");
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(BerTlvPath("6F/84").find(tlvs, tlv));
+    EXPECT_THROW(BerTlvPath("6F/A5/85").find(tlvs, tlv), IllegalArgumentException);
+}
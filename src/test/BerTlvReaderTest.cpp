@@ -0,0 +1,218 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "BerTlvReader.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> TLV1 = HexUtil::toByteArray(
+    "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C2005141001");
+
+static std::vector<uint8_t> getValue(const BerTlvReader& reader, const BerTlvReader::Tlv& tlv)
+{
+    return std::vector<uint8_t>(reader.getValue(tlv), reader.getValue(tlv) + tlv.valueLength);
+}
+
+TEST(BerTlvReaderTest, next_whenStructureIsEmpty_shouldReturnFalse)
+{
+    BerTlvReader reader(nullptr, 0);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_FALSE(reader.next(tlv));
+}
+
+TEST(BerTlvReaderTest, next_whenStructureIsValid_shouldReportAllTagsInDocumentOrder)
+{
+    BerTlvReader reader(TLV1);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0x6F);
+    ASSERT_EQ(tlv.offset, 0U);
+    ASSERT_EQ(tlv.valueOffset, 2U);
+    ASSERT_EQ(tlv.valueLength, 0x23U);
+    ASSERT_EQ(tlv.depth, 0);
+    ASSERT_TRUE(tlv.constructed);
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0x84);
+    ASSERT_EQ(tlv.depth, 1);
+    ASSERT_FALSE(tlv.constructed);
+    ASSERT_EQ(getValue(reader, tlv), HexUtil::toByteArray("315449432E49434131"));
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0xA5);
+    ASSERT_EQ(tlv.depth, 1);
+    ASSERT_TRUE(tlv.constructed);
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0xBF0C);
+    ASSERT_EQ(tlv.offset, 15U);
+    ASSERT_EQ(tlv.valueOffset, 18U);
+    ASSERT_EQ(tlv.depth, 2);
+    ASSERT_TRUE(tlv.constructed);
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0xC7);
+    ASSERT_EQ(tlv.depth, 3);
+    ASSERT_EQ(getValue(reader, tlv), HexUtil::toByteArray("0000000011223344"));
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0x53);
+    ASSERT_EQ(tlv.depth, 3);
+    ASSERT_EQ(getValue(reader, tlv), HexUtil::toByteArray("0A3C2005141001"));
+
+    ASSERT_FALSE(reader.next(tlv));
+}
+
+TEST(BerTlvReaderTest, next_whenValuesPointIntoTheBuffer_shouldNotCopy)
+{
+    BerTlvReader reader(TLV1);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(reader.getValue(tlv), TLV1.data() + 2);
+}
+
+TEST(BerTlvReaderTest, next_whenSeveralTopLevelTagsAndEmptyConstructed_shouldReportThem)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("A5008401AA9F0C820001BB");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0xA5);
+    ASSERT_EQ(tlv.valueLength, 0U);
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0x84);
+    ASSERT_EQ(tlv.depth, 0);
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0x9F0C);
+    ASSERT_EQ(tlv.valueOffset, 10U);
+    ASSERT_EQ(tlv.valueLength, 1U);
+    ASSERT_FALSE(reader.next(tlv));
+}
+
+TEST(BerTlvReaderTest, next_whenTagIs4BytesAndLengthIsLongForm_shouldDecodeThem)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("DF8182018400000001AA");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, static_cast<int>(0xDF818201));
+    ASSERT_EQ(tlv.valueOffset, 9U);
+    ASSERT_EQ(tlv.valueLength, 1U);
+    ASSERT_FALSE(tlv.constructed);
+    ASSERT_FALSE(reader.next(tlv));
+}
+
+TEST(BerTlvReaderTest, skip_whenTlvIsConstructed_shouldContinueWithNextSibling)
+{
+    BerTlvReader reader(TLV1);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_TRUE(reader.next(tlv));
+    ASSERT_EQ(tlv.tag, 0xA5);
+
+    reader.skip(tlv);
+
+    ASSERT_FALSE(reader.next(tlv));
+}
+
+TEST(BerTlvReaderTest, next_whenValueIsTruncated_shouldIAE)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("6F23A5");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    EXPECT_THROW(reader.next(tlv), IllegalArgumentException);
+}
+
+TEST(BerTlvReaderTest, next_whenErrorIsRequested_shouldReportItWithoutThrowing)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("6F058401AA8502");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+    BerTlvReader::Error error;
+
+    ASSERT_TRUE(reader.next(tlv, error));
+    ASSERT_TRUE(reader.next(tlv, error));
+    ASSERT_FALSE(reader.next(tlv, error));
+    ASSERT_EQ(error, BerTlvReader::Error::OUT_OF_BOUNDS);
+    ASSERT_EQ(reader.getOffset(), 5U);
+}
+
+TEST(BerTlvReaderTest, next_whenChildGoesBeyondItsParent_shouldIAE)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("A503840201028400");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    ASSERT_TRUE(reader.next(tlv));
+    EXPECT_THROW(reader.next(tlv), IllegalArgumentException);
+}
+
+TEST(BerTlvReaderTest, next_whenLengthFieldIsInvalid_shouldIAE)
+{
+    const std::vector<uint8_t> tlvs = HexUtil::toByteArray("6F80");
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    EXPECT_THROW(reader.next(tlv), IllegalArgumentException);
+}
+
+TEST(BerTlvReaderTest, next_whenStructureIsTooDeep_shouldIAE)
+{
+    std::vector<uint8_t> tlvs;
+    for (int i = 0; i <= BerTlvReader::MAX_DEPTH; i++) {
+        tlvs.push_back(0xA5);
+        tlvs.push_back(static_cast<uint8_t>(2 * (BerTlvReader::MAX_DEPTH - i)));
+    }
+
+    BerTlvReader reader(tlvs);
+    BerTlvReader::Tlv tlv;
+
+    EXPECT_THROW(while (reader.next(tlv)) {}, IllegalArgumentException);
+}
+
+TEST(BerTlvReaderTest, readAll_whenPrimitiveOnly_shouldReportOnlyPrimitiveTags)
+{
+    const std::vector<BerTlvReader::Tlv> tlvs = BerTlvReader::readAll(TLV1, true);
+
+    ASSERT_EQ(tlvs.size(), 3U);
+    ASSERT_EQ(tlvs[0].tag, 0x84);
+    ASSERT_EQ(tlvs[1].tag, 0xC7);
+    ASSERT_EQ(tlvs[2].tag, 0x53);
+    ASSERT_EQ(tlvs.capacity(), 3U);
+}
+
+TEST(BerTlvReaderTest, readAll_whenNotPrimitiveOnly_shouldReportAllTags)
+{
+    const std::vector<BerTlvReader::Tlv> tlvs = BerTlvReader::readAll(TLV1, false);
+
+    ASSERT_EQ(tlvs.size(), 6U);
+    ASSERT_EQ(tlvs[0].tag, 0x6F);
+    ASSERT_EQ(tlvs[5].tag, 0x53);
+}
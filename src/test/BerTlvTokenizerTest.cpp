@@ -0,0 +1,264 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "BerTlvTokenizer.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static const std::vector<uint8_t> TLV1 = HexUtil::toByteArray(
+    "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C2005141001");
+
+/* Serializes the events, e.g. "<6F 84:315449432E49434131 >6F" */
+static std::string tokenize(BerTlvTokenizer& tokenizer)
+{
+    std::string result;
+    BerTlvTokenizer::Event event;
+
+    while (tokenizer.next(event)) {
+        if (!result.empty()) {
+            result += " ";
+        }
+
+        switch (event.type) {
+        case BerTlvTokenizer::EventType::START_CONSTRUCTED:
+            result += "<" + HexUtil::toHex(static_cast<uint32_t>(event.tag));
+            break;
+        case BerTlvTokenizer::EventType::PRIMITIVE:
+            result += HexUtil::toHex(static_cast<uint32_t>(event.tag)) + ":" +
+                      HexUtil::toHex(std::vector<uint8_t>(event.value,
+                                                          event.value + event.length));
+            break;
+        case BerTlvTokenizer::EventType::END_CONSTRUCTED:
+            result += ">" + HexUtil::toHex(static_cast<uint32_t>(event.tag));
+            break;
+        }
+    }
+
+    return result;
+}
+
+static const std::string TLV1_EVENTS =
+    "<6F 84:315449432E49434131 <A5 <BF0C C7:0000000011223344 53:0A3C2005141001 >BF0C >A5 >6F";
+
+TEST(BerTlvTokenizerTest, next_whenNothingFed_shouldReturnFalse)
+{
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+
+    ASSERT_FALSE(tokenizer.next(event));
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenStructureFedAtOnce_shouldReportAllEvents)
+{
+    BerTlvTokenizer tokenizer;
+
+    tokenizer.feed(TLV1);
+
+    ASSERT_EQ(tokenize(tokenizer), TLV1_EVENTS);
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenStructureFedByteByByte_shouldReportSameEvents)
+{
+    BerTlvTokenizer tokenizer;
+    std::string result;
+
+    for (size_t i = 0; i < TLV1.size(); i++) {
+        tokenizer.feed(&TLV1[i], 1);
+
+        const std::string events = tokenize(tokenizer);
+        if (!events.empty()) {
+            result += (result.empty() ? "" : " ") + events;
+        }
+    }
+
+    ASSERT_EQ(result, TLV1_EVENTS);
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenStructureFedInChunks_shouldReportEventsAsSoonAsComplete)
+{
+    BerTlvTokenizer tokenizer;
+    const std::vector<uint8_t> chunk1(TLV1.begin(), TLV1.begin() + 20);
+    const std::vector<uint8_t> chunk2(TLV1.begin() + 20, TLV1.end());
+
+    tokenizer.feed(chunk1);
+
+    ASSERT_EQ(tokenize(tokenizer), "<6F 84:315449432E49434131 <A5 <BF0C");
+    ASSERT_FALSE(tokenizer.isComplete());
+
+    tokenizer.feed(chunk2);
+
+    ASSERT_EQ(tokenize(tokenizer), "C7:0000000011223344 53:0A3C2005141001 >BF0C >A5 >6F");
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenSeveralTopLevelTlvs_shouldReportAll)
+{
+    BerTlvTokenizer tokenizer;
+    const std::vector<uint8_t> data = HexUtil::toByteArray("8401AAE000DF1F021122");
+
+    tokenizer.feed(data);
+
+    ASSERT_EQ(tokenize(tokenizer), "84:AA <E0 >E0 DF1F:1122");
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenLengthIsLongForm_shouldDecodeLength)
+{
+    BerTlvTokenizer tokenizer;
+    std::vector<uint8_t> data = HexUtil::toByteArray("8482012C");
+    data.resize(4 + 300, 0x55);
+
+    tokenizer.feed(data.data(), 100);
+
+    BerTlvTokenizer::Event event;
+    ASSERT_FALSE(tokenizer.next(event));
+
+    tokenizer.feed(data.data() + 100, data.size() - 100);
+
+    ASSERT_TRUE(tokenizer.next(event));
+    ASSERT_EQ(event.type, BerTlvTokenizer::EventType::PRIMITIVE);
+    ASSERT_EQ(event.tag, 0x84);
+    ASSERT_EQ(event.length, 300U);
+    ASSERT_EQ(std::vector<uint8_t>(event.value, event.value + event.length),
+              std::vector<uint8_t>(data.begin() + 4, data.end()));
+    ASSERT_FALSE(tokenizer.next(event));
+}
+
+TEST(BerTlvTokenizerTest, next_whenTagIs4BytesAndHeaderSplit_shouldDecodeIt)
+{
+    BerTlvTokenizer tokenizer;
+    const std::vector<uint8_t> data = HexUtil::toByteArray("FF8182038400000005DF818201");
+    const std::vector<uint8_t> end = HexUtil::toByteArray("00");
+
+    tokenizer.feed(data);
+    ASSERT_EQ(tokenize(tokenizer), "<FF818203");
+
+    tokenizer.feed(end);
+    ASSERT_EQ(tokenize(tokenizer), "DF818201: >FF818203");
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, next_whenChildExceedsParent_shouldThrowIAE)
+{
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+    const std::vector<uint8_t> data = HexUtil::toByteArray("6F038404AABBCCDD");
+
+    tokenizer.feed(data);
+
+    ASSERT_TRUE(tokenizer.next(event));
+    EXPECT_THROW(tokenizer.next(event), IllegalArgumentException);
+}
+
+TEST(BerTlvTokenizerTest, next_whenLengthIsInvalid_shouldThrowIAE)
+{
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+    const std::vector<uint8_t> data = HexUtil::toByteArray("8480");
+
+    tokenizer.feed(data);
+
+    EXPECT_THROW(tokenizer.next(event), IllegalArgumentException);
+}
+
+TEST(BerTlvTokenizerTest, next_whenTooDeep_shouldThrowIAE)
+{
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+    std::vector<uint8_t> data;
+
+    for (int i = 0; i <= BerTlvTokenizer::MAX_DEPTH; i++) {
+        data.push_back(0xE0);
+        data.push_back(static_cast<uint8_t>(2 * (BerTlvTokenizer::MAX_DEPTH - i)));
+    }
+
+    tokenizer.feed(data);
+
+    for (int i = 0; i < BerTlvTokenizer::MAX_DEPTH; i++) {
+        ASSERT_TRUE(tokenizer.next(event));
+    }
+    EXPECT_THROW(tokenizer.next(event), IllegalArgumentException);
+}
+
+TEST(BerTlvTokenizerTest, next_whenAnnouncedValueLengthIsHuge_shouldThrowIAEWithoutBuffering)
+{
+    /* 2 GiB announced, 1 byte received */
+    const std::vector<uint8_t> tlv = HexUtil::toByteArray("84847FFFFFFFAA");
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+
+    tokenizer.feed(tlv);
+
+    EXPECT_THROW(tokenizer.next(event), IllegalArgumentException);
+}
+
+TEST(BerTlvTokenizerTest, next_whenValueExceedsConfiguredMaximum_shouldThrowIAE)
+{
+    const std::vector<uint8_t> tlv = HexUtil::toByteArray("8403AABBCC");
+    BerTlvTokenizer tokenizer(2);
+    BerTlvTokenizer::Event event;
+
+    tokenizer.feed(tlv);
+
+    EXPECT_THROW(tokenizer.next(event), IllegalArgumentException);
+}
+
+TEST(BerTlvTokenizerTest, next_whenValueReachesConfiguredMaximum_shouldReportIt)
+{
+    const std::vector<uint8_t> tlv = HexUtil::toByteArray("8403AABBCC");
+    BerTlvTokenizer tokenizer(3);
+
+    tokenizer.feed(tlv.data(), 3);
+    ASSERT_EQ(tokenize(tokenizer), "");
+    tokenizer.feed(tlv.data() + 3, 2);
+    ASSERT_EQ(tokenize(tokenizer), "84:AABBCC");
+}
+
+TEST(BerTlvTokenizerTest, isComplete_whenStructureIsTruncated_shouldReturnFalse)
+{
+    BerTlvTokenizer tokenizer;
+    const std::vector<uint8_t> data(TLV1.begin(), TLV1.end() - 1);
+
+    tokenizer.feed(data);
+    tokenize(tokenizer);
+
+    ASSERT_FALSE(tokenizer.isComplete());
+
+    tokenizer.reset();
+
+    ASSERT_TRUE(tokenizer.isComplete());
+}
+
+TEST(BerTlvTokenizerTest, feed_whenPreviousChunkNotConsumed_shouldThrowISE)
+{
+    BerTlvTokenizer tokenizer;
+    BerTlvTokenizer::Event event;
+
+    tokenizer.feed(TLV1);
+    tokenizer.next(event);
+
+    EXPECT_THROW(tokenizer.feed(TLV1), IllegalStateException);
+}
@@ -214,6 +214,70 @@ TEST(BerTlvUtilTest, parseSimple_whenLengthIsThreeBytes_shouldValue)
     ASSERT_TRUE(Arrays::containsOnly(it->second, static_cast<uint8_t>(0xA5)));
 }
 
+TEST(BerTlvUtilTest, parseSimple_whenLengthIsFourBytes_shouldValue)
+{
+    /* Length 65540 */
+    std::vector<uint8_t> tlv(65545);
+
+    tlv[0] = 0x84;
+    tlv[1] = 0x83;
+    tlv[2] = 0x01;
+    tlv[3] = 0x00;
+    tlv[4] = 0x04;
+    for (int i = 5; i < 65545; i++) {
+        tlv[i] = 0xA5;
+    }
+
+    const auto tlvs = BerTlvUtil::parseSimple(tlv, false);
+    const auto it = tlvs.find(0x84);
+    ASSERT_NE(it, tlvs.end());
+    ASSERT_EQ(static_cast<int>(it->second.size()), 65540);
+    ASSERT_TRUE(Arrays::containsOnly(it->second, static_cast<uint8_t>(0xA5)));
+}
+
+TEST(BerTlvUtilTest, parseSimple_whenLengthIsFiveBytes_shouldValue)
+{
+    const auto tlvs = BerTlvUtil::parseSimple(HexUtil::toByteArray("8484000000021122"), false);
+
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x84, HexUtil::toByteArray("1122")));
+}
+
+TEST(BerTlvUtilTest, parseSimple_whenLengthFieldIsTooLong_shouldIAE)
+{
+    EXPECT_THROW(BerTlvUtil::parseSimple(HexUtil::toByteArray("84850000000002AABB"), false),
+                 IllegalArgumentException);
+}
+
+TEST(BerTlvUtilTest, parseSimple_whenValueIsTruncated_shouldIAE)
+{
+    EXPECT_THROW(BerTlvUtil::parseSimple(HexUtil::toByteArray("8404AABBCC"), false),
+                 IllegalArgumentException);
+}
+
+TEST(BerTlvUtilTest, parseSimple_whenStructureIsEmpty_shouldIAE)
+{
+    EXPECT_THROW(BerTlvUtil::parseSimple(std::vector<uint8_t>(), false),
+                 IllegalArgumentException);
+    EXPECT_THROW(BerTlvUtil::parseSimple(HexUtil::toByteArray("E000"), false),
+                 IllegalArgumentException);
+}
+
+TEST(BerTlvUtilTest, parse_whenTagsIdIs4Bytes_shouldProvideTheTag)
+{
+    auto tlvs = BerTlvUtil::parse(HexUtil::toByteArray("FF81820307DF81820102AABB5F2001CC"), false);
+
+    ASSERT_TRUE(mapContainsOnlyKeys(tlvs, {static_cast<int>(0xFF818203), static_cast<int>(0xDF818201), 0x5F20}));
+    ASSERT_TRUE(vectorContainsExactly(tlvs[static_cast<int>(0xFF818203)], HexUtil::toByteArray("DF81820102AABB")));
+    ASSERT_TRUE(vectorContainsExactly(tlvs[static_cast<int>(0xDF818201)], HexUtil::toByteArray("AABB")));
+    ASSERT_TRUE(vectorContainsExactly(tlvs[0x5F20], HexUtil::toByteArray("CC")));
+}
+
+TEST(BerTlvUtilTest, parse_whenTagIdExceeds4Bytes_shouldIAE)
+{
+    EXPECT_THROW(BerTlvUtil::parse(HexUtil::toByteArray("DF8182830101AA"), false),
+                 IllegalArgumentException);
+}
+
 TEST(BerTlvUtilTest, isConstructed_when1ByteTagIsConstructed_shouldReturnTrue)
 {
     ASSERT_TRUE(BerTlvUtil::isConstructed(0x6F));
@@ -253,3 +317,193 @@ TEST(BerTlvUtilTest, isConstructed_whenTagIsTooLarge_shouldIAE)
 {
     EXPECT_THROW(BerTlvUtil::isConstructed(0x1000000), IllegalArgumentException);
 }
+
+TEST(BerTlvUtilTest, isConstructed_when4ByteTagIsConstructed_shouldReturnTrue)
+{
+    ASSERT_TRUE(BerTlvUtil::isConstructed(0x3F818201));
+    ASSERT_TRUE(BerTlvUtil::isConstructed(static_cast<int>(0xFF818201)));
+}
+
+TEST(BerTlvUtilTest, isConstructed_when4ByteTagIsPrimitive_shouldReturnFalse)
+{
+    ASSERT_FALSE(BerTlvUtil::isConstructed(static_cast<int>(0xDF818201)));
+}
+
+TEST(BerTlvUtilTest, tryParse_whenStructureIsValid_shouldReturnNoErrorAndSameTagsAsParse)
+{
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    const BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParse(HexUtil::toByteArray(TLV1), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::NONE);
+    ASSERT_EQ(result.errorOffset, 0U);
+    ASSERT_EQ(tlvs, BerTlvUtil::parse(HexUtil::toByteArray(TLV1), false));
+}
+
+TEST(BerTlvUtilTest, tryParse_whenValueIsTruncated_shouldReturnOutOfBoundsAndEmptyMap)
+{
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    const BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParse(HexUtil::toByteArray("8401AA8503BBCC"), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::OUT_OF_BOUNDS);
+    ASSERT_EQ(result.errorOffset, 3U);
+    ASSERT_TRUE(tlvs.empty());
+}
+
+TEST(BerTlvUtilTest, tryParse_whenLengthFieldIsInvalid_shouldReturnInvalidLength)
+{
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    const BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParse(HexUtil::toByteArray("6F048480AABB"), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::INVALID_LENGTH);
+    ASSERT_EQ(result.errorOffset, 2U);
+}
+
+TEST(BerTlvUtilTest, tryParse_whenTagFieldIsTooLong_shouldReturnInvalidTag)
+{
+    std::map<const int, std::vector<std::vector<uint8_t>>> tlvs;
+
+    const BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParse(HexUtil::toByteArray("DF8182830101AA"), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::INVALID_TAG);
+    ASSERT_EQ(result.errorOffset, 0U);
+}
+
+TEST(BerTlvUtilTest, tryParseSimple_whenConstructedValueIsEmpty_shouldReturnEmptyStructure)
+{
+    std::map<const int, const std::vector<uint8_t>> tlvs;
+
+    BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParseSimple(HexUtil::toByteArray("8401AAE000"), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::EMPTY_STRUCTURE);
+    ASSERT_EQ(result.errorOffset, 3U);
+    ASSERT_TRUE(tlvs.empty());
+
+    result = BerTlvUtil::tryParseSimple(std::vector<uint8_t>(), false, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::EMPTY_STRUCTURE);
+    ASSERT_EQ(result.errorOffset, 0U);
+}
+
+TEST(BerTlvUtilTest, tryParseSimple_whenStructureIsValid_shouldReturnSameTagsAsParseSimple)
+{
+    std::map<const int, const std::vector<uint8_t>> tlvs;
+
+    const BerTlvUtil::ParseResult result =
+        BerTlvUtil::tryParseSimple(HexUtil::toByteArray(TLV2), true, tlvs);
+
+    ASSERT_EQ(result.error, BerTlvReader::Error::NONE);
+    ASSERT_EQ(tlvs, BerTlvUtil::parseSimple(HexUtil::toByteArray(TLV2), true));
+}
+
+TEST(BerTlvUtilTest, findTags_whenTagsAreRequested_shouldProvideOnlyThem)
+{
+    const auto tlvs = BerTlvUtil::findTags(HexUtil::toByteArray(TLV1), {0x84, 0x53});
+
+    ASSERT_EQ(tlvs.size(), 2);
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x84, HexUtil::toByteArray("315449432E49434131")));
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x53, HexUtil::toByteArray("0A3C2005141001")));
+}
+
+TEST(BerTlvUtilTest, findTags_whenAllRequestedTagsFound_shouldIgnoreTheRest)
+{
+    /* The structure is invalid after 84 */
+    const auto tlvs = BerTlvUtil::findTags(HexUtil::toByteArray("8401AA8580"), {0x84});
+
+    ASSERT_EQ(tlvs.size(), 1);
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x84, HexUtil::toByteArray("AA")));
+}
+
+TEST(BerTlvUtilTest, findTags_whenRequestedTagsAreDuplicated_shouldStillStopOnceAllFound)
+{
+    /* The structure is invalid after 84 */
+    const auto tlvs = BerTlvUtil::findTags(HexUtil::toByteArray("8401AA8580"), {0x84, 0x84});
+
+    ASSERT_EQ(tlvs.size(), 1);
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x84, HexUtil::toByteArray("AA")));
+}
+
+TEST(BerTlvUtilTest, findTags_whenSingleTagIsRequested_shouldNotSelectThePrimitiveOnlyOverload)
+{
+    const auto tlvs = BerTlvUtil::findTags(HexUtil::toByteArray(TLV1), {1});
+
+    ASSERT_TRUE(tlvs.empty());
+}
+
+TEST(BerTlvUtilTest, findTags_whenMaxDepthIsReached_shouldSkipSubtrees)
+{
+    /* The content of A5 is not walked, it would be invalid otherwise */
+    const auto tlvs = BerTlvUtil::findTags(HexUtil::toByteArray("6F078401AAA5028580"), {}, 1);
+
+    ASSERT_EQ(tlvs.size(), 3);
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0x84, HexUtil::toByteArray("AA")));
+    ASSERT_TRUE(mapContainsEntry(tlvs, 0xA5, HexUtil::toByteArray("8580")));
+}
+
+TEST(BerTlvUtilTest, findAllTags_whenTagsAreRequestedWithMaxDepth_shouldProvideOccurrencesAboveIt)
+{
+    const std::vector<uint8_t> tlvStructure = HexUtil::toByteArray("C101AAE003C101BBC101CC");
+
+    auto tlvs = BerTlvUtil::findAllTags(tlvStructure, {0xC1}, 0);
+
+    ASSERT_TRUE(mapContainsOnlyKeys(tlvs, {0xC1}));
+    ASSERT_TRUE(vectorContainsExactly(tlvs[0xC1],
+                                      {HexUtil::toByteArray("AA"), HexUtil::toByteArray("CC")}));
+
+    tlvs = BerTlvUtil::findAllTags(tlvStructure, {0xC1});
+
+    ASSERT_TRUE(vectorContainsExactly(tlvs[0xC1],
+                                      {HexUtil::toByteArray("AA"),
+                                       HexUtil::toByteArray("BB"),
+                                       HexUtil::toByteArray("CC")}));
+}
+
+TEST(BerTlvUtilTest, findAllTags_whenStructureIsInvalidWithinMaxDepth_shouldIAE)
+{
+    EXPECT_THROW(BerTlvUtil::findAllTags(HexUtil::toByteArray("6F048480AABB"), {0x84}, 1),
+                 IllegalArgumentException);
+}
+
+TEST(BerTlvUtilTest, parse_whenBufferIsProvided_shouldAllocateFromItAndProvideSameTags)
+{
+    MonotonicBuffer buffer(64);
+    const std::vector<uint8_t> tlvStructure = HexUtil::toByteArray(TLV1);
+    const auto expected = BerTlvUtil::parse(tlvStructure, false);
+
+    for (int i = 0; i < 2; i++) {
+        {
+            const BerTlvUtil::ArenaMap tlvs = BerTlvUtil::parse(tlvStructure, false, buffer);
+
+            ASSERT_EQ(tlvs.size(), expected.size());
+            for (const auto& entry : expected) {
+                const auto& values = tlvs.at(entry.first);
+                ASSERT_EQ(values.size(), entry.second.size());
+                for (size_t j = 0; j < values.size(); j++) {
+                    ASSERT_TRUE(std::equal(values[j].begin(), values[j].end(),
+                                           entry.second[j].begin()));
+                }
+            }
+
+            ASSERT_GT(buffer.getUsed(), 0U);
+        }
+
+        buffer.release();
+
+        ASSERT_EQ(buffer.getUsed(), 0U);
+    }
+}
+
+TEST(BerTlvUtilTest, parse_whenBufferIsProvidedAndStructureIsInvalid_shouldIAE)
+{
+    MonotonicBuffer buffer;
+
+    EXPECT_THROW(BerTlvUtil::parse(HexUtil::toByteArray("6F23A5"), false, buffer),
+                 IllegalArgumentException);
+}
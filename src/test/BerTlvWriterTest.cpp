@@ -0,0 +1,201 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "BerTlvWriter.h"
+
+/* Keyple Core Util */
+#include "BerTlvUtil.h"
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+#include "IllegalStateException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+TEST(BerTlvWriterTest, getBytes_whenNothingWritten_shouldReturnEmptyArray)
+{
+    BerTlvWriter writer;
+
+    ASSERT_TRUE(writer.getBytes().empty());
+    ASSERT_EQ(writer.size(), 0U);
+}
+
+TEST(BerTlvWriterTest, add_shouldEncodeTagLengthValue)
+{
+    BerTlvWriter writer;
+
+    writer.add(0x84, HexUtil::toByteArray("315449432E49434131"));
+
+    ASSERT_EQ(HexUtil::toHex(writer.getBytes()), "8409315449432E49434131");
+}
+
+TEST(BerTlvWriterTest, add_whenTagIsMultiByte_shouldWriteSignificantBytes)
+{
+    BerTlvWriter writer;
+    const std::vector<uint8_t> value = HexUtil::toByteArray("AA");
+
+    writer.add(0x5F24, value).add(0xDF8101, value).add(0xDF818201, value);
+
+    ASSERT_EQ(HexUtil::toHex(writer.getBytes()), "5F2401AADF810101AADF81820101AA");
+}
+
+TEST(BerTlvWriterTest, add_shouldUseShortestLengthForm)
+{
+    BerTlvWriter writer;
+
+    writer.add(0x04, std::vector<uint8_t>(0x7F));
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(writer.getBytes().begin(),
+                                                  writer.getBytes().begin() + 2)), "047F");
+    writer.reset();
+
+    writer.add(0x04, std::vector<uint8_t>(0x80));
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(writer.getBytes().begin(),
+                                                  writer.getBytes().begin() + 3)), "048180");
+    ASSERT_EQ(writer.size(), 3U + 0x80);
+    writer.reset();
+
+    writer.add(0x04, std::vector<uint8_t>(0x100));
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(writer.getBytes().begin(),
+                                                  writer.getBytes().begin() + 4)), "04820100");
+    writer.reset();
+
+    writer.add(0x04, std::vector<uint8_t>(0x10000));
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(writer.getBytes().begin(),
+                                                  writer.getBytes().begin() + 5)), "0483010000");
+    ASSERT_EQ(writer.size(), 5U + 0x10000);
+}
+
+TEST(BerTlvWriterTest, endConstructed_shouldBackPatchLength)
+{
+    BerTlvWriter writer;
+
+    writer.startConstructed(0x6F)
+          .add(0x84, HexUtil::toByteArray("315449432E49434131"))
+          .startConstructed(0xA5)
+          .startConstructed(0xBF0C)
+          .add(0xC7, HexUtil::toByteArray("0000000011223344"))
+          .add(0x53, HexUtil::toByteArray("0A3C2005141001"))
+          .endConstructed()
+          .endConstructed()
+          .endConstructed();
+
+    ASSERT_EQ(HexUtil::toHex(writer.getBytes()),
+              "6F238409315449432E49434131A516BF0C13C708000000001122334453070A3C2005141001");
+}
+
+TEST(BerTlvWriterTest, endConstructed_whenValueIsLong_shouldShiftValue)
+{
+    BerTlvWriter writer;
+    const std::vector<uint8_t> value(200, 0x55);
+
+    writer.startConstructed(0xE0).startConstructed(0xE1).add(0xC1, value).endConstructed()
+          .endConstructed();
+
+    const std::vector<uint8_t>& bytes = writer.getBytes();
+    ASSERT_EQ(bytes.size(), 3U + 3U + 3U + 200U);
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(bytes.begin(), bytes.begin() + 9)),
+              "E081CEE181CBC181C8");
+
+    const auto tlvs = BerTlvUtil::parse(bytes, true);
+    ASSERT_EQ(tlvs.at(0xC1).at(0), value);
+}
+
+TEST(BerTlvWriterTest, startConstructed_whenSizeHintIsProvided_shouldWriteSameBytes)
+{
+    BerTlvWriter writer;
+    BerTlvWriter hinted;
+    const std::vector<uint8_t> value(200, 0x55);
+
+    writer.startConstructed(0xE0).startConstructed(0xE1).add(0xC1, value).endConstructed()
+          .endConstructed();
+    hinted.startConstructed(0xE0, 206).startConstructed(0xE1, 203).add(0xC1, value)
+          .endConstructed().endConstructed();
+
+    ASSERT_EQ(hinted.getBytes(), writer.getBytes());
+}
+
+TEST(BerTlvWriterTest, startConstructed_whenSizeHintIsWrong_shouldStillUseShortestLengthForm)
+{
+    BerTlvWriter writer;
+
+    writer.startConstructed(0xE0, 1000).add(0xC1, HexUtil::toByteArray("01")).endConstructed();
+    writer.startConstructed(0xE1, 0).add(0xC1, std::vector<uint8_t>(0x100)).endConstructed();
+
+    const std::vector<uint8_t>& bytes = writer.getBytes();
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>(bytes.begin(), bytes.begin() + 13)),
+              "E003C10101E1820104C1820100");
+    ASSERT_EQ(bytes.size(), 5U + 4U + 4U + 0x100U);
+}
+
+TEST(BerTlvWriterTest, add_whenValueIsInTheBuffer_shouldCopyItBeforeGrowing)
+{
+    BerTlvWriter writer(4);
+
+    writer.add(0xC1, HexUtil::toByteArray("0102"));
+
+    /* Repeats the first TLV, the buffer being reallocated */
+    const std::vector<uint8_t>& bytes = writer.getBytes();
+    writer.add(0xE0, bytes.data(), bytes.size());
+
+    ASSERT_EQ(HexUtil::toHex(writer.getBytes()), "C1020102E004C1020102");
+}
+
+TEST(BerTlvWriterTest, startConstructed_whenTagIsPrimitive_shouldThrowIAE)
+{
+    BerTlvWriter writer;
+
+    EXPECT_THROW(writer.startConstructed(0x84), IllegalArgumentException);
+    EXPECT_THROW(writer.startConstructed(0x9F0C), IllegalArgumentException);
+}
+
+TEST(BerTlvWriterTest, startConstructed_whenTooDeep_shouldThrowISE)
+{
+    BerTlvWriter writer;
+
+    for (int i = 0; i < BerTlvWriter::MAX_DEPTH; i++) {
+        writer.startConstructed(0xE0);
+    }
+
+    EXPECT_THROW(writer.startConstructed(0xE0), IllegalStateException);
+}
+
+TEST(BerTlvWriterTest, endConstructed_whenNothingOpen_shouldThrowISE)
+{
+    BerTlvWriter writer;
+
+    EXPECT_THROW(writer.endConstructed(), IllegalStateException);
+}
+
+TEST(BerTlvWriterTest, getBytes_whenConstructedNotClosed_shouldThrowISE)
+{
+    BerTlvWriter writer;
+
+    writer.startConstructed(0xE0);
+
+    EXPECT_THROW(writer.getBytes(), IllegalStateException);
+}
+
+TEST(BerTlvWriterTest, reset_shouldDiscardContent)
+{
+    BerTlvWriter writer;
+
+    writer.startConstructed(0xE0).add(0xC1, HexUtil::toByteArray("01"));
+    writer.reset();
+    writer.add(0xC2, HexUtil::toByteArray("02"));
+
+    ASSERT_EQ(HexUtil::toHex(writer.getBytes()), "C20102");
+}
@@ -0,0 +1,77 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+/* Util */
+#include "BinaryLogCodec.h"
+#include "KeypleStd.h"
+
+using namespace testing;
+
+using namespace keyple::core::util::cpp;
+
+template <typename... Args>
+static std::string encodeAndDecode(const char* format, const Args&... args)
+{
+    uint8_t buffer[256] = {0};
+    size_t length = 0;
+
+    EXPECT_TRUE(BinaryLogCodec::encode(buffer, sizeof(buffer), length, args...));
+
+    return BinaryLogCodec::decode(format, buffer, length);
+}
+
+TEST(BinaryLogCodecTest, decode_whenNoArguments_shouldReturnTheFormat)
+{
+    ASSERT_EQ(encodeAndDecode("no argument\n"), "no argument\n");
+}
+
+TEST(BinaryLogCodecTest, decode_whenValues_shouldRenderThemAsTheTextMode)
+{
+    const std::string name = "reader";
+    const std::vector<uint8_t> apdu = {0x00, 0xB2, 0x01, 0x14};
+    const uint8_t sw1 = 0x90;
+
+    ASSERT_EQ(encodeAndDecode("% % % % %", 12, -3L, 1.5, name, apdu), "12 -3 1.5 reader 00B20114");
+    ASSERT_EQ(encodeAndDecode("sw1 = %", sw1), "sw1 = 144(0x90)");
+}
+
+TEST(BinaryLogCodecTest, decode_whenPointer_shouldRenderThePointedValue)
+{
+    const int value = 42;
+
+    ASSERT_EQ(encodeAndDecode("value %", &value), "value 42");
+}
+
+TEST(BinaryLogCodecTest, decode_whenOtherType_shouldRenderItsText)
+{
+    const std::vector<std::string> names = {"a", "b"};
+
+    ASSERT_EQ(encodeAndDecode("names %", names), "names {a, b}");
+}
+
+TEST(BinaryLogCodecTest, decode_whenArityMismatch_shouldReportIt)
+{
+    ASSERT_EQ(encodeAndDecode("% and %", 1), "1 and % [invalid format: missing arguments]");
+    ASSERT_EQ(encodeAndDecode("only %", 1, 2), "only 1 [invalid format: extra arguments]");
+}
+
+TEST(BinaryLogCodecTest, encode_whenArgumentsDontFit_shouldReturnFalse)
+{
+    uint8_t buffer[16];
+    size_t length = 0;
+    const std::string text(32, 'x');
+
+    ASSERT_FALSE(BinaryLogCodec::encode(buffer, sizeof(buffer), length, text));
+}
@@ -0,0 +1,117 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "HexDecoder.h"
+
+#include <algorithm>
+#include <sstream>
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+static std::string makeHex(const size_t length)
+{
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0; i < length; i++) {
+        data[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+
+    return HexUtil::toHex(data);
+}
+
+TEST(HexDecoderTest, update_whenChunksHaveOddLengths_shouldProduceTheBytesOfTheConcatenation)
+{
+    const std::string hex = makeHex(10000);
+    std::ostringstream os;
+    HexDecoder decoder(os);
+
+    /* Irregular chunk sizes, most of them odd, some larger than the internal buffer */
+    size_t offset = 0;
+    for (size_t chunk = 1; offset < hex.size(); chunk = chunk * 3 + 2) {
+        const size_t length = std::min(chunk, hex.size() - offset);
+        decoder.update(hex.data() + offset, length);
+        offset += length;
+    }
+    decoder.finish();
+
+    const std::string bytes = os.str();
+    ASSERT_EQ(std::vector<uint8_t>(bytes.begin(), bytes.end()), HexUtil::toByteArray(hex));
+}
+
+TEST(HexDecoderTest, update_whenOneCharacterAtATime_shouldProduceOneByteEveryTwoCharacters)
+{
+    std::vector<uint8_t> bytes;
+    HexDecoder decoder([&bytes](const uint8_t* data, const size_t length) {
+        bytes.insert(bytes.end(), data, data + length);
+    });
+
+    decoder.update("A");
+    ASSERT_EQ(bytes.size(), 0U);
+    decoder.update("b");
+    decoder.update("");
+    decoder.update("C");
+    decoder.update("d");
+    decoder.finish();
+
+    ASSERT_EQ(bytes, std::vector<uint8_t>({0xAB, 0xCD}));
+}
+
+TEST(HexDecoderTest, update_whenCharacterIsInvalid_shouldThrowIAEWithStreamOffset)
+{
+    HexDecoder decoder([](const uint8_t*, const size_t) {});
+
+    decoder.update("0123");
+    decoder.update("4");
+
+    try {
+        decoder.update("5G7");
+        FAIL();
+    } catch (const IllegalArgumentException& e) {
+        ASSERT_EQ(e.getMessage(), "Invalid hexadecimal character at offset 6.");
+    }
+
+    decoder.reset();
+    decoder.update("0");
+
+    try {
+        decoder.update("x");
+        FAIL();
+    } catch (const IllegalArgumentException& e) {
+        ASSERT_EQ(e.getMessage(), "Invalid hexadecimal character at offset 1.");
+    }
+}
+
+TEST(HexDecoderTest, finish_whenOddNumberOfCharacters_shouldThrowIAEAndReset)
+{
+    std::vector<uint8_t> bytes;
+    HexDecoder decoder([&bytes](const uint8_t* data, const size_t length) {
+        bytes.insert(bytes.end(), data, data + length);
+    });
+
+    decoder.update("ABC");
+    ASSERT_EQ(decoder.getLength(), 1U);
+    EXPECT_THROW(decoder.finish(), IllegalArgumentException);
+
+    decoder.update("12");
+    decoder.finish();
+    ASSERT_EQ(bytes, std::vector<uint8_t>({0xAB, 0x12}));
+}
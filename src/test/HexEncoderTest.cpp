@@ -0,0 +1,82 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "HexEncoder.h"
+
+#include <algorithm>
+#include <sstream>
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+
+static std::vector<uint8_t> makeData(const size_t length)
+{
+    std::vector<uint8_t> data(length);
+
+    for (size_t i = 0; i < length; i++) {
+        data[i] = static_cast<uint8_t>(i * 13 + 5);
+    }
+
+    return data;
+}
+
+TEST(HexEncoderTest, update_whenNoData_shouldProduceNothing)
+{
+    std::ostringstream os;
+    HexEncoder encoder(os);
+
+    encoder.update(std::vector<uint8_t>());
+
+    ASSERT_EQ(os.str(), "");
+    ASSERT_EQ(encoder.getLength(), 0U);
+}
+
+TEST(HexEncoderTest, update_whenChunksAreProvided_shouldProduceTheHexOfTheConcatenation)
+{
+    const std::vector<uint8_t> data = makeData(10000);
+    std::ostringstream os;
+    HexEncoder encoder(os);
+
+    /* Irregular chunk sizes, some larger than the internal buffer */
+    size_t offset = 0;
+    for (size_t chunk = 1; offset < data.size(); chunk = chunk * 3 + 1) {
+        const size_t length = std::min(chunk, data.size() - offset);
+        encoder.update(data.data() + offset, length);
+        offset += length;
+    }
+
+    ASSERT_EQ(os.str(), HexUtil::toHex(data));
+    ASSERT_EQ(encoder.getLength(), 20000U);
+}
+
+TEST(HexEncoderTest, update_whenSinkIsACallback_shouldNotExceedTheBufferSize)
+{
+    const std::vector<uint8_t> data = makeData(5000);
+    std::string hex;
+    size_t maxLength = 0;
+    HexEncoder encoder([&hex, &maxLength](const char* chars, const size_t length) {
+        hex.append(chars, length);
+        maxLength = std::max(maxLength, length);
+    });
+
+    encoder.update(data);
+
+    ASSERT_EQ(hex, HexUtil::toHex(data));
+    ASSERT_LE(maxLength, 4096U);
+}
@@ -0,0 +1,55 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "HexLiteral.h"
+
+/* Keyple Core Util */
+#include "HexUtil.h"
+#include "IllegalArgumentException.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+using namespace keyple::core::util::cpp::exception;
+
+/* Evaluated at compile time, would not build otherwise */
+static constexpr std::array<uint8_t, 0> EMPTY = HexLiteral::toByteArray("");
+static constexpr std::array<uint8_t, 13> SELECT =
+    HexLiteral::toByteArray("00A4040007A000000004101000");
+
+TEST(HexLiteralTest, toByteArray_whenHexIsEmpty_shouldReturnEmptyArray)
+{
+    ASSERT_EQ(EMPTY.size(), 0U);
+}
+
+TEST(HexLiteralTest, toByteArray_whenHexIsValid_shouldBeSuccessful)
+{
+    const std::vector<uint8_t> expected = HexUtil::toByteArray("00A4040007A000000004101000");
+
+    ASSERT_EQ(std::vector<uint8_t>(SELECT.begin(), SELECT.end()), expected);
+}
+
+TEST(HexLiteralTest, toByteArray_whenHexIsLowerCase_shouldBeSuccessful)
+{
+    constexpr std::array<uint8_t, 3> tab = HexLiteral::toByteArray("abcdef");
+
+    ASSERT_EQ(std::vector<uint8_t>(tab.begin(), tab.end()),
+              std::vector<uint8_t>({0xAB, 0xCD, 0xEF}));
+}
+
+TEST(HexLiteralTest, toByteArray_whenHexIsInvalidAtRuntime_shouldThrowIAE)
+{
+    EXPECT_THROW(HexLiteral::toByteArray("0G"), IllegalArgumentException);
+}
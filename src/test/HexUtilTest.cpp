@@ -46,6 +46,20 @@ TEST(HexUtilTest, isValid_whenHexContainsNotHexDigits_shouldReturnFalse)
     ASSERT_FALSE(HexUtil::isValid("0123456789ABCDEG"));
 }
 
+TEST(HexUtilTest, isValid_whenHexIsLarge_shouldDetectAnyInvalidCharacter)
+{
+    /* Covers the vectorized blocks and the remaining characters */
+    const std::string hex = HexUtil::toHex(std::vector<uint8_t>(100, 0x5A));
+
+    ASSERT_TRUE(HexUtil::isValid(hex));
+
+    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+        std::string invalid = hex;
+        invalid[i] = i % 2 ? 'g' : static_cast<char>(0xB0);
+        ASSERT_FALSE(HexUtil::isValid(invalid));
+    }
+}
+
 TEST(HexUtilTest, toByteArray_whenHexIsEmpty_shouldReturnEmptyArray)
 {
     ASSERT_EQ(static_cast<int>(HexUtil::toByteArray("").size()), 0);
@@ -62,6 +76,103 @@ TEST(HexUtilTest, toByteArray_whenHexIsValid_shouldBeSuccessful)
                               {0xAB, 0xCD, 0xEF, 0xAB, 0xCD, 0xEF}));
 }
 
+TEST(HexUtilTest, toByteArray_whenHexIsLarge_shouldConvertAllCharacters)
+{
+    for (int length = 1; length <= 100; length++) {
+        std::vector<uint8_t> tab(length);
+
+        for (int i = 0; i < length; i++) {
+            tab[i] = static_cast<uint8_t>(i * 37 + length);
+        }
+
+        ASSERT_EQ(HexUtil::toByteArray(HexUtil::toHex(tab)), tab);
+    }
+}
+
+TEST(HexUtilTest, decode_whenHexIsEmpty_shouldReturnNposAndEmptyArray)
+{
+    std::vector<uint8_t> tab = {0x01};
+
+    ASSERT_EQ(HexUtil::decode("", tab), HexUtil::npos);
+    ASSERT_EQ(static_cast<int>(tab.size()), 0);
+}
+
+TEST(HexUtilTest, decode_whenHexIsValid_shouldReturnNposAndConvert)
+{
+    std::vector<uint8_t> tab;
+
+    ASSERT_EQ(HexUtil::decode("ABCDEFabcdef0123456789", tab), HexUtil::npos);
+    ASSERT_EQ(tab, std::vector<uint8_t>({0xAB, 0xCD, 0xEF, 0xAB, 0xCD, 0xEF,
+                                         0x01, 0x23, 0x45, 0x67, 0x89}));
+}
+
+TEST(HexUtilTest, decode_whenHexHasOddLength_shouldReturnLastOffset)
+{
+    std::vector<uint8_t> tab;
+
+    ASSERT_EQ(HexUtil::decode("ABCDE", tab), 4U);
+}
+
+TEST(HexUtilTest, decode_whenHexContainsNotHexDigits_shouldReturnFirstInvalidOffset)
+{
+    const std::string hex = HexUtil::toHex(std::vector<uint8_t>(100, 0xC3));
+    std::vector<uint8_t> tab;
+
+    for (int i = 0; i < static_cast<int>(hex.length()); i++) {
+        std::string invalid = hex;
+        invalid[i] = ' ';
+        if (i + 3 < static_cast<int>(hex.length())) {
+            invalid[i + 3] = 'x';
+        }
+        ASSERT_EQ(HexUtil::decode(invalid, tab), static_cast<size_t>(i));
+    }
+}
+
+TEST(HexUtilTest, decode_whenHexIsASlice_shouldOnlyConvertTheSlice)
+{
+    const char buffer[] = "xxABCDEFyy";
+    uint8_t tab[4] = {0x00, 0x00, 0x00, 0x00};
+
+    ASSERT_EQ(HexUtil::decode(buffer + 2, 6, tab), HexUtil::npos);
+    ASSERT_EQ(tab[0], 0xAB);
+    ASSERT_EQ(tab[1], 0xCD);
+    ASSERT_EQ(tab[2], 0xEF);
+    ASSERT_EQ(tab[3], 0x00);
+    ASSERT_EQ(HexUtil::decode(buffer, 6, tab), 0U);
+}
+
+TEST(HexUtilTest, isValid_whenHexIsASlice_shouldOnlyCheckTheSlice)
+{
+    const char buffer[] = "xxABCDEFyy";
+
+    ASSERT_TRUE(HexUtil::isValid(buffer + 2, 6));
+    ASSERT_FALSE(HexUtil::isValid(buffer + 2, 7));
+    ASSERT_FALSE(HexUtil::isValid(buffer + 2, 0));
+}
+
+TEST(HexUtilTest, toByteArray_whenHexIsASlice_shouldWriteIntoTheBuffer)
+{
+    const char buffer[] = "xxABCDEFyy";
+    uint8_t tab[3];
+
+    ASSERT_EQ(HexUtil::toByteArray(buffer + 2, 6, tab), 3U);
+    ASSERT_EQ(tab[0], 0xAB);
+    ASSERT_EQ(tab[1], 0xCD);
+    ASSERT_EQ(tab[2], 0xEF);
+    EXPECT_THROW(HexUtil::toByteArray(buffer + 2, 5, tab), StringIndexOutOfBoundsException);
+}
+
+TEST(HexUtilTest, toNumber_whenHexIsASlice_shouldOnlyConvertTheSlice)
+{
+    const char buffer[] = "xx123456789ABCDEF0yy";
+
+    ASSERT_EQ(HexUtil::toByte(buffer + 2, 2), 0x12);
+    ASSERT_EQ(HexUtil::toShort(buffer + 2, 4), 0x1234);
+    ASSERT_EQ(HexUtil::toInt(buffer + 2, 8), 0x12345678U);
+    ASSERT_EQ(HexUtil::toLong(buffer + 2, 16), 0x123456789ABCDEF0ULL);
+    ASSERT_EQ(HexUtil::toLong(buffer, 0), 0U);
+}
+
 TEST(HexUtilTest, toByte_whenHexIsEmpty_shouldReturn0)
 {
     ASSERT_EQ(HexUtil::toByte(""), 0);
@@ -153,6 +264,42 @@ TEST(HexUtilTest, toHex_byte_array)
     ASSERT_EQ(HexUtil::toHex(static_cast<uint8_t>(0xFE)), "FE");
 }
 
+TEST(HexUtilTest, toHex_whenByteArrayIsEmpty_shouldReturnEmptyString)
+{
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>()), "");
+}
+
+TEST(HexUtilTest, toHex_whenByteArrayIsValid_shouldBeSuccessful)
+{
+    ASSERT_EQ(HexUtil::toHex(std::vector<uint8_t>({0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF})),
+              "0123456789ABCDEF");
+}
+
+TEST(HexUtilTest, toHex_whenByteArrayIsLarge_shouldConvertAllBytes)
+{
+    /* Covers the vectorized blocks and the remaining bytes of every length up to 100 */
+    for (int length = 1; length <= 100; length++) {
+        std::vector<uint8_t> tab(length);
+        std::string expected;
+
+        for (int i = 0; i < length; i++) {
+            tab[i] = static_cast<uint8_t>(i * 37 + length);
+            expected += HexUtil::toHex(tab[i]);
+        }
+
+        ASSERT_EQ(HexUtil::toHex(tab), expected);
+    }
+}
+
+TEST(HexUtilTest, toHex_whenBytesAreASlice_shouldWriteIntoTheBuffer)
+{
+    const uint8_t tab[] = {0x00, 0x12, 0xAB, 0xFF};
+    char hex[8] = {'x', 'x', 'x', 'x', 'x', 'x', 'x', 'x'};
+
+    ASSERT_EQ(HexUtil::toHex(tab + 1, 3, hex), 6U);
+    ASSERT_EQ(std::string(hex, 8), "12ABFFxx");
+}
+
 TEST(HexUtilTest, toHex_byte)
 {
     ASSERT_EQ(HexUtil::toHex(static_cast<uint8_t>(0xFE)), "FE");
@@ -183,3 +330,47 @@ TEST(HexUtilTest, toHex_long)
     ASSERT_EQ(HexUtil::toHex(static_cast<uint64_t>(0xFE3456789ABCDEL)), "FE3456789ABCDE");
     ASSERT_EQ(HexUtil::toHex(static_cast<uint64_t>(0xFE3456789ABCDEF0L)), "FE3456789ABCDEF0");
 }
+
+TEST(HexUtilTest, toHex_whenValueIsZero_shouldReturnOneByte)
+{
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint16_t>(0)), "00");
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint32_t>(0)), "00");
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint64_t>(0)), "00");
+}
+
+TEST(HexUtilTest, toHex_whenDestIsProvided_shouldWriteSignificantCharacters)
+{
+    char hex[16];
+
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint8_t>(0x0E), hex), 2U);
+    ASSERT_EQ(std::string(hex, 2), "0E");
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint16_t>(0x0E34), hex), 4U);
+    ASSERT_EQ(std::string(hex, 4), "0E34");
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint32_t>(0x3456), hex), 4U);
+    ASSERT_EQ(std::string(hex, 4), "3456");
+    ASSERT_EQ(HexUtil::toHex(static_cast<uint64_t>(0xFE3456789ABCDEF0ULL), hex), 16U);
+    ASSERT_EQ(std::string(hex, 16), "FE3456789ABCDEF0");
+}
+
+TEST(HexUtilTest, toFixedHex_short)
+{
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint16_t>(0)), "0000");
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint16_t>(0xFE)), "00FE");
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint16_t>(0x9000)), "9000");
+}
+
+TEST(HexUtilTest, toFixedHex_int)
+{
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint32_t>(0)), "00000000");
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint32_t>(0xFE34)), "0000FE34");
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint32_t>(0xFE345678)), "FE345678");
+}
+
+TEST(HexUtilTest, toFixedHex_long)
+{
+    char hex[16];
+
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint64_t>(0xFE34ULL)), "000000000000FE34");
+    ASSERT_EQ(HexUtil::toFixedHex(static_cast<uint64_t>(0xFE3456789ABCDEF0ULL), hex), 16U);
+    ASSERT_EQ(std::string(hex, 16), "FE3456789ABCDEF0");
+}
@@ -0,0 +1,191 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+/* Util */
+#include "KeypleStd.h"
+#include "LogFormat.h"
+#include "Logger.h"
+#include "LoggerFactory.h"
+
+using namespace testing;
+
+using namespace keyple::core::util::cpp;
+
+struct Format {
+    static constexpr const char* str()
+    {
+        return "cmd % sent, length % (100%%)";
+    }
+};
+
+struct NoPlaceholder {
+    static constexpr const char* str()
+    {
+        return "no placeholder";
+    }
+};
+
+struct OnlyPlaceholders {
+    static constexpr const char* str()
+    {
+        return "%%";
+    }
+};
+
+static_assert(LogFormat::count(Format::str()) == 3, "count");
+static_assert(LogFormat::count(NoPlaceholder::str()) == 0, "count");
+static_assert(LogFormat::next(Format::str(), 0) == 4, "next");
+static_assert(LogFormat::next(Format::str(), 5) == 19, "next");
+static_assert(LogFormat::next(NoPlaceholder::str(), 0) == 14, "next");
+
+class LogFormatTest : public Test {
+protected:
+    void SetUp() override
+    {
+        Logger::setLoggerLevel(Logger::Level::logInfo);
+    }
+
+    void TearDown() override
+    {
+        Logger::setLoggerLevel(Logger::Level::logError);
+    }
+};
+
+TEST_F(LogFormatTest, format_whenArgumentsMatch_shouldReplaceThePlaceholders)
+{
+    std::ostringstream os;
+    const std::string cmd = "00B2";
+
+    LogFormat::format<Format>(os, cmd, 5, 'x');
+
+    ASSERT_EQ(os.str(), "cmd 00B2 sent, length 5 (100%x)");
+}
+
+TEST_F(LogFormatTest, format_whenNoPlaceholder_shouldWriteTheFormat)
+{
+    std::ostringstream os;
+
+    LogFormat::format<NoPlaceholder>(os);
+
+    ASSERT_EQ(os.str(), "no placeholder");
+}
+
+TEST_F(LogFormatTest, format_whenArgumentIsAPointer_shouldWriteThePointedValue)
+{
+    std::ostringstream os;
+    const int value = 12;
+
+    LogFormat::format<OnlyPlaceholders>(os, &value);
+
+    ASSERT_EQ(os.str(), "%12");
+}
+
+TEST_F(LogFormatTest, logMacro_shouldWriteTheSameMessageAsTheRuntimeFormatting)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(LogFormatTest));
+    const std::vector<uint8_t> apdu = {0x00, 0xB2, 0x01, 0x3C};
+    const uint8_t sfi = 0x07;
+
+    internal::CaptureStdout();
+    logger->info("APDU % sfi % len %\n", apdu, sfi, apdu.size());
+    const std::string expected = internal::GetCapturedStdout();
+
+    internal::CaptureStdout();
+    KEYPLE_LOG_INFO(logger, "APDU % sfi % len %\n", apdu, sfi, apdu.size());
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_NE(output.find("APDU "), std::string::npos);
+    ASSERT_EQ(output.substr(output.find("APDU ")), expected.substr(expected.find("APDU ")));
+}
+
+TEST_F(LogFormatTest, logMacro_whenNoArgument_shouldWriteTheFormat)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(LogFormatTest));
+
+    internal::CaptureStdout();
+    KEYPLE_LOG_WARN(logger, "card removed\n");
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_NE(output.find("WARN"), std::string::npos);
+    ASSERT_NE(output.find("card removed\n"), std::string::npos);
+}
+
+TEST_F(LogFormatTest, logMacro_whenLevelIsDisabled_shouldWriteNothing)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(LogFormatTest));
+
+    internal::CaptureStdout();
+    KEYPLE_LOG_DEBUG(logger, "value %\n", 1);
+
+    ASSERT_EQ(internal::GetCapturedStdout(), "");
+}
+
+TEST_F(LogFormatTest, logMacro_whenBinaryMode_shouldWriteTheSameMessage)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(LogFormatTest));
+
+    Logger::setAsyncMode(true);
+    Logger::setBinaryMode(true);
+
+    internal::CaptureStdout();
+    KEYPLE_LOG_INFO(logger, "counter % of %\n", 3, std::string("file"));
+    Logger::flush();
+    const std::string output = internal::GetCapturedStdout();
+
+    Logger::setBinaryMode(false);
+    Logger::setAsyncMode(false);
+
+    ASSERT_NE(output.find("counter 3 of file\n"), std::string::npos);
+}
+
+static int evaluations = 0;
+
+static std::string countEvaluation()
+{
+    evaluations++;
+    return "evaluated";
+}
+
+static_assert(Logger::isCompiledIn(Logger::Level::logTrace), "isCompiledIn");
+
+TEST_F(LogFormatTest, logMacro_whenLevelIsDisabled_shouldNotEvaluateTheArguments)
+{
+    const std::unique_ptr<Logger> logger = LoggerFactory::getLogger(typeid(LogFormatTest));
+    evaluations = 0;
+
+    internal::CaptureStdout();
+    KEYPLE_LOG_TRACE(logger, "value %\n", countEvaluation());
+    KEYPLE_LOG_DEBUG(logger, "value %\n", countEvaluation());
+    KEYPLE_LOG_INFO(logger, "value %\n", countEvaluation());
+    const std::string output = internal::GetCapturedStdout();
+
+    ASSERT_EQ(evaluations, 1);
+    ASSERT_NE(output.find("value evaluated\n"), std::string::npos);
+}
+
+TEST_F(LogFormatTest, isEnabled_shouldFollowTheLoggerLevel)
+{
+    ASSERT_TRUE(Logger::isEnabled(Logger::Level::logError));
+    ASSERT_TRUE(Logger::isEnabled(Logger::Level::logInfo));
+    ASSERT_FALSE(Logger::isEnabled(Logger::Level::logDebug));
+
+    Logger::setLoggerLevel(Logger::Level::logTrace);
+
+    ASSERT_TRUE(Logger::isEnabled(Logger::Level::logTrace));
+}
@@ -0,0 +1,81 @@
+/**************************************************************************************************
+ * Copyright (c) 2023 Calypso Networks Association https://calypsonet.org/                        *
+ *                                                                                                *
+ * See the NOTICE file(s) distributed with this work for additional information regarding         *
+ * copyright ownership.                                                                           *
+ *                                                                                                *
+ * This program and the accompanying materials are made available under the terms of the Eclipse  *
+ * Public License 2.0 which is available at http://www.eclipse.org/legal/epl-2.0                  *
+ *                                                                                                *
+ * SPDX-License-Identifier: EPL-2.0                                                               *
+ **************************************************************************************************/
+
+#include "gmock/gmock.h"
+#include "gtest/gtest.h"
+
+#include "MonotonicBuffer.h"
+
+using namespace testing;
+
+using namespace keyple::core::util;
+
+TEST(MonotonicBufferTest, allocate_shouldReturnAlignedContiguousStorage)
+{
+    MonotonicBuffer buffer(256);
+
+    uint8_t* a = static_cast<uint8_t*>(buffer.allocate(3, 1));
+    uint64_t* b = static_cast<uint64_t*>(buffer.allocate(sizeof(uint64_t), alignof(uint64_t)));
+
+    ASSERT_EQ(reinterpret_cast<uintptr_t>(b) % alignof(uint64_t), 0U);
+    ASSERT_EQ(reinterpret_cast<uint8_t*>(b) - a, 8);
+    ASSERT_EQ(buffer.getUsed(), 16U);
+}
+
+TEST(MonotonicBufferTest, allocate_whenBlockIsFull_shouldChainANewBlock)
+{
+    MonotonicBuffer buffer(16);
+
+    buffer.allocate(10, 1);
+    buffer.allocate(10, 1);
+    buffer.allocate(100, 1);
+
+    ASSERT_EQ(buffer.getUsed(), 120U);
+    ASSERT_GE(buffer.getCapacity(), 146U);
+}
+
+TEST(MonotonicBufferTest, release_shouldMergeBlocksForNextUse)
+{
+    MonotonicBuffer buffer(16);
+
+    buffer.allocate(10, 1);
+    buffer.allocate(100, 1);
+
+    const size_t capacity = buffer.getCapacity();
+    buffer.release();
+
+    ASSERT_EQ(buffer.getUsed(), 0U);
+    ASSERT_EQ(buffer.getCapacity(), capacity);
+
+    /* Now fits in the merged block */
+    uint8_t* a = static_cast<uint8_t*>(buffer.allocate(10, 1));
+    uint8_t* b = static_cast<uint8_t*>(buffer.allocate(100, 1));
+
+    ASSERT_EQ(b - a, 10);
+    ASSERT_EQ(buffer.getCapacity(), capacity);
+}
+
+TEST(MonotonicBufferTest, Allocator_shouldServeStandardContainers)
+{
+    MonotonicBuffer buffer;
+    const MonotonicBuffer::Allocator<int> allocator(buffer);
+    std::vector<int, MonotonicBuffer::Allocator<int>> values(allocator);
+
+    for (int i = 0; i < 100; i++) {
+        values.push_back(i);
+    }
+
+    ASSERT_EQ(values.size(), 100U);
+    ASSERT_EQ(values[99], 99);
+    ASSERT_GE(buffer.getUsed(), 100 * sizeof(int));
+    ASSERT_TRUE(values.get_allocator() == MonotonicBuffer::Allocator<uint8_t>(buffer));
+}